@@ -1,5 +1,6 @@
 import 'dart:convert';
 import 'dart:io';
+import 'dart:math';
 
 import 'package:colorize/colorize.dart';
 import 'package:core_generator/src/comment.dart';
@@ -176,7 +177,8 @@ class Definition {
           // to decode and store what it needs.
           continue;
         }
-        code.writeln('${property.type.cppName} m_${property.capitalizedName}');
+        code.writeln(
+            '${property.type.cppStorageName} m_${property.capitalizedName}');
 
         var initialize = property.initialValueRuntime ??
             property.initialValue ??
@@ -231,6 +233,9 @@ class Definition {
 
     if (!_isAbstract) {
       code.writeln('Core* clone() const override;');
+      code.writeln('size_t cloneSize() const override;');
+      code.writeln('Core* cloneInto(void* memory) const override;');
+      code.writeln('void assignProperties(const Core* source) override;');
     }
 
     if (properties.isNotEmpty || _extensionOf == null) {
@@ -250,6 +255,27 @@ class Definition {
       code.writeln('}');
       code.writeln();
 
+      code.writeln('void assign(const ${_name}Base& object) {');
+      for (final property in properties) {
+        if (property.isEncoded) {
+          // Encoded properties are only set on import.
+          continue;
+        }
+        code.writeln('if(m_${property.capitalizedName} != '
+            'object.m_${property.capitalizedName})'
+            '{'
+            'm_${property.capitalizedName} = '
+            'object.m_${property.capitalizedName};'
+            '${property.name}Changed();'
+            '}');
+      }
+      if (_extensionOf != null) {
+        code.writeln('${_extensionOf.name}::'
+            'assign(object); ');
+      }
+      code.writeln('}');
+      code.writeln();
+
       code.writeln('bool deserialize(uint16_t propertyKey, '
           'BinaryReader& reader) override {');
 
@@ -313,6 +339,7 @@ class Definition {
       StringBuffer cppCode = StringBuffer();
       cppCode.writeln('#include "rive/generated/$localCodeFilename"');
       cppCode.writeln('#include "$concreteCodeFilename"');
+      cppCode.writeln('#include <new>');
       cppCode.writeln();
       cppCode.writeln('using namespace rive;');
       cppCode.writeln();
@@ -321,6 +348,20 @@ class Definition {
           'cloned->copy(*this); '
           'return cloned; '
           '}');
+      cppCode.writeln();
+      cppCode.writeln('size_t ${_name}Base::cloneSize() const { '
+          'return sizeof($_name); '
+          '}');
+      cppCode.writeln();
+      cppCode.writeln('Core* ${_name}Base::cloneInto(void* memory) const { '
+          'auto cloned = new (memory) $_name(); '
+          'cloned->copy(*this); '
+          'return cloned; '
+          '}');
+      cppCode.writeln();
+      cppCode.writeln('void ${_name}Base::assignProperties(const Core* source) { '
+          'assign(*source->as<${_name}Base>()); '
+          '}');
       var cppFile = File('$generatedCppPath$localCppCodeFilename');
       cppFile.createSync(recursive: true);
       var formattedCode = await _formatter.format(cppCode.toString());
@@ -479,19 +520,69 @@ class Definition {
       ctxCode.writeln('}');
     }
 
-    ctxCode.writeln('static int propertyFieldId(int propertyKey) {');
-    ctxCode.writeln('switch(propertyKey) {');
-
-    for (final fieldType in usedFieldTypes.keys) {
-      var properties = usedFieldTypes[fieldType];
+    // Typed thunks so callers can resolve the propertyKey switch once and
+    // then get/set the property directly.
+    for (final fieldType in getSetFieldTypes.keys) {
+      ctxCode.writeln(
+          'static ${fieldType.runtimeCoreType}::Setter '
+          '${fieldType.uncapitalizedName}Setter(int propertyKey){');
+      ctxCode.writeln('switch (propertyKey) {');
+      var properties = getSetFieldTypes[fieldType];
       for (final property in properties) {
         ctxCode.writeln('case ${property.definition.name}Base'
             '::${property.name}PropertyKey:');
+        ctxCode.writeln('return [](Core* object, ${fieldType.cppName} value) {'
+            'object->as<${property.definition.name}Base>()->'
+            '${property.name}(value);};');
       }
-      ctxCode.writeln('return Core${fieldType.capitalizedName}Type::id;');
+      ctxCode.writeln('}');
+      ctxCode.writeln('return nullptr;');
+      ctxCode.writeln('}');
+    }
+    for (final fieldType in getSetFieldTypes.keys) {
+      ctxCode.writeln(
+          'static ${fieldType.runtimeCoreType}::Getter '
+          '${fieldType.uncapitalizedName}Getter(int propertyKey){');
+      ctxCode.writeln('switch (propertyKey) {');
+      var properties = getSetFieldTypes[fieldType];
+      for (final property in properties) {
+        ctxCode.writeln('case ${property.definition.name}Base'
+            '::${property.name}PropertyKey:');
+        ctxCode.writeln('return [](Core* object) {'
+            'return object->as<${property.definition.name}Base>()->'
+            '${property.name}();};');
+      }
+      ctxCode.writeln('}');
+      ctxCode.writeln('return nullptr;');
+      ctxCode.writeln('}');
     }
 
-    ctxCode.writeln('default: return -1;}}');
+    // Property keys are small and dense, so their field types are looked up
+    // in a table rather than a switch.
+    var fieldIds = <int, Property>{};
+    for (final fieldType in usedFieldTypes.keys) {
+      for (final property in usedFieldTypes[fieldType]) {
+        fieldIds[property.key.intValue] = property;
+      }
+    }
+    var maxPropertyKey = fieldIds.keys.reduce(max);
+    ctxCode.writeln('static int propertyFieldId(int propertyKey) {');
+    ctxCode.writeln(
+        '// The field type id of each property key, -1 for unknown keys.');
+    ctxCode.writeln('static const int8_t fieldIds[] = {');
+    for (var key = 0; key <= maxPropertyKey; key++) {
+      var property = fieldIds[key];
+      if (property == null) {
+        ctxCode.writeln('-1,');
+      } else {
+        ctxCode.writeln('Core${property.type.capitalizedName}Type::id, '
+            '// ${property.definition.name}Base'
+            '::${property.name}PropertyKey');
+      }
+    }
+    ctxCode.writeln('};');
+    ctxCode.writeln('return propertyKey >= 0 && '
+        'propertyKey < (int)sizeof(fieldIds) ? fieldIds[propertyKey] : -1;}');
 
     ctxCode.writeln('};}');
 
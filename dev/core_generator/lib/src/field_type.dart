@@ -12,6 +12,7 @@ abstract class FieldType {
   final String include;
   String get cppName => _cppName;
   String get cppGetterName => _cppName;
+  String get cppStorageName => _cppName;
 
   String _runtimeCoreType;
   String get runtimeCoreType => _runtimeCoreType;
@@ -3,13 +3,17 @@ import '../field_type.dart';
 class StringFieldType extends FieldType {
   StringFieldType()
       : super('String', 'CoreStringType',
-            cppName: 'std::string', include: '<string>');
+            cppName: 'std::string', include: 'rive/shared_string.hpp');
   @override
   String get defaultValue => '""';
 
   @override
   String get cppGetterName => 'const std::string&';
 
+  // Copies of an object share the characters until they're set.
+  @override
+  String get cppStorageName => 'SharedString';
+
   @override
   String convertCpp(String value) {
     var result = value;
@@ -55,6 +55,11 @@ do
         symbols 'On'
     end
 
+    filter 'system:linux'
+    do
+        links {'pthread'}
+    end
+
     filter 'system:windows'
     do
         flags {'FatalWarnings'}
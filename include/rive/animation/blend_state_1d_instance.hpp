@@ -17,6 +17,7 @@ private:
 public:
     BlendState1DInstance(const BlendState1D* blendState, ArtboardInstance* instance);
     void advance(float seconds, Span<SMIInput*> inputs) override;
+    void reset() override;
 };
 } // namespace rive
 #endif
\ No newline at end of file
@@ -52,6 +52,16 @@ public:
 
     bool keepGoing() const override { return m_KeepGoing; }
 
+    void reset() override
+    {
+        for (auto& animation : m_AnimationInstances)
+        {
+            animation.m_AnimationInstance.reset();
+            animation.m_Mix = 0.0f;
+        }
+        m_KeepGoing = true;
+    }
+
     void advance(float seconds, Span<SMIInput*>) override
     {
         m_KeepGoing = false;
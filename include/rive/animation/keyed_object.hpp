@@ -6,6 +6,7 @@ namespace rive
 {
 class Artboard;
 class KeyedProperty;
+struct KeyedPropertyBinding;
 class KeyedObject : public KeyedObjectBase
 {
 private:
@@ -20,6 +21,12 @@ public:
     StatusCode onAddedClean(CoreContext* context) override;
     void apply(Artboard* coreContext, float time, float mix);
 
+    /// Resolve the keyed object in artboard and append a binding for each of
+    /// its keyed properties.
+    void bind(Artboard* artboard, std::vector<KeyedPropertyBinding>& bindings) const;
+
+    size_t numKeyedProperties() const { return m_KeyedProperties.size(); }
+
     StatusCode import(ImportStack& importStack) override;
 };
 } // namespace rive
@@ -1,14 +1,60 @@
 #ifndef _RIVE_KEYED_PROPERTY_HPP_
 #define _RIVE_KEYED_PROPERTY_HPP_
+#include "rive/core/property_accessors.hpp"
 #include "rive/generated/animation/keyed_property_base.hpp"
 #include <vector>
 namespace rive
 {
+class CubicInterpolator;
 class KeyFrame;
+class KeyedProperty;
+
+/// A KeyedProperty bound to the object it animates in a specific artboard
+/// instance, along with the keyframe cursor for that binding. Animation
+/// instances build a table of these once so that applying doesn't need to
+/// resolve object ids every frame.
+struct KeyedPropertyBinding
+{
+    Core* object;
+    KeyedProperty* property;
+    int cursor;
+};
+
+/// The type of value stored by a KeyedProperty's keyframes.
+enum class KeyFrameValueType : uint8_t
+{
+    none,
+    number,
+    color,
+    boolean,
+    id
+};
+
+/// How the segment starting at a keyframe is interpolated.
+struct KeyFrameInterpolation
+{
+    /// Null for linear interpolation.
+    const CubicInterpolator* cubic;
+    /// The keyframe's value is held until the next keyframe.
+    bool hold;
+};
+
 class KeyedProperty : public KeyedPropertyBase
 {
 private:
+    // Keyframes are only held onto while importing, once they're resolved
+    // they're compacted into the contiguous arrays below and freed.
     std::vector<std::unique_ptr<KeyFrame>> m_KeyFrames;
+    PropertyAccessors m_Accessors;
+
+    KeyFrameValueType m_ValueType = KeyFrameValueType::none;
+    std::vector<float> m_Seconds;
+    // Raw bits of each keyframe's value, interpreted per m_ValueType.
+    std::vector<uint32_t> m_Values;
+    std::vector<KeyFrameInterpolation> m_Interpolations;
+
+    void compactKeyFrames();
+    template <typename T> void applyKeyFrames(Core* object, int index, float seconds, float mix);
 
 public:
     KeyedProperty();
@@ -17,7 +63,23 @@ public:
     StatusCode onAddedClean(CoreContext* context) override;
     StatusCode onAddedDirty(CoreContext* context) override;
 
-    void apply(Core* object, float time, float mix);
+    /// Apply the keyframes at the given time to object. When provided,
+    /// cursor holds the index of the keyframe found by the last apply and is
+    /// used as the starting point for the search (and updated with the new
+    /// index), which is O(1) for sequential playback.
+    void apply(Core* object, float time, float mix, int* cursor = nullptr);
+
+    /// Returns the index of the first keyframe at or after seconds.
+    int closestFrameIndex(float seconds) const;
+
+    /// Same as closestFrameIndex(seconds) but walks from the index hint
+    /// (usually the result of the previous search) and only falls back to a
+    /// binary search when the time has moved by more than a few keyframes.
+    int closestFrameIndex(float seconds, int hint) const;
+
+    size_t numKeyFrames() const { return m_Seconds.size(); }
+    KeyFrameValueType valueType() const { return m_ValueType; }
+    const PropertyAccessors& accessors() const { return m_Accessors; }
 
     StatusCode import(ImportStack& importStack) override;
 };
@@ -18,12 +18,6 @@ public:
     void computeSeconds(int fps);
 
     StatusCode onAddedDirty(CoreContext* context) override;
-    virtual void apply(Core* object, int propertyKey, float mix) = 0;
-    virtual void applyInterpolation(Core* object,
-                                    int propertyKey,
-                                    float seconds,
-                                    const KeyFrame* nextFrame,
-                                    float mix) = 0;
 
     StatusCode import(ImportStack& importStack) override;
 };
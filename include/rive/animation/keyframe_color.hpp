@@ -4,15 +4,7 @@
 namespace rive
 {
 class KeyFrameColor : public KeyFrameColorBase
-{
-public:
-    void apply(Core* object, int propertyKey, float mix) override;
-    void applyInterpolation(Core* object,
-                            int propertyKey,
-                            float seconds,
-                            const KeyFrame* nextFrame,
-                            float mix) override;
-};
+{};
 } // namespace rive
 
-#endif
\ No newline at end of file
+#endif
@@ -3,16 +3,12 @@
 #include "rive/generated/animation/keyframe_double_base.hpp"
 namespace rive
 {
+// This whole class is intentionally misnamed to match our editor code. The
+// editor uses doubles (float64) for numeric values but at runtime 32 bit
+// floating point numbers suffice. So even though this is a "double keyframe" to
+// match editor names, the actual values are stored and applied in 32 bits.
 class KeyFrameDouble : public KeyFrameDoubleBase
-{
-public:
-    void apply(Core* object, int propertyKey, float mix) override;
-    void applyInterpolation(Core* object,
-                            int propertyKey,
-                            float seconds,
-                            const KeyFrame* nextFrame,
-                            float mix) override;
-};
+{};
 } // namespace rive
 
-#endif
\ No newline at end of file
+#endif
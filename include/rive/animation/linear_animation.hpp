@@ -7,6 +7,7 @@ namespace rive
 {
 class Artboard;
 class KeyedObject;
+struct KeyedPropertyBinding;
 
 class LinearAnimation : public LinearAnimationBase
 {
@@ -23,6 +24,15 @@ public:
     void addKeyedObject(std::unique_ptr<KeyedObject>);
     void apply(Artboard* artboard, float time, float mix = 1.0f) const;
 
+    /// Bind every keyed property to the object it animates in artboard.
+    void bind(Artboard* artboard, std::vector<KeyedPropertyBinding>& bindings) const;
+
+    /// Apply previously bound keyed properties (see bind).
+    static void apply(std::vector<KeyedPropertyBinding>& bindings, float time, float mix = 1.0f);
+
+    /// Total number of keyed properties across all the keyed objects.
+    size_t keyedPropertyCount() const;
+
     Loop loop() const { return (Loop)loopValue(); }
 
     StatusCode import(ImportStack& importStack) override;
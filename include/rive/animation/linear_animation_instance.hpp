@@ -1,6 +1,7 @@
 #ifndef _RIVE_LINEAR_ANIMATION_INSTANCE_HPP_
 #define _RIVE_LINEAR_ANIMATION_INSTANCE_HPP_
 
+#include "rive/animation/keyed_property.hpp"
 #include "rive/artboard.hpp"
 #include "rive/scene.hpp"
 
@@ -20,6 +21,11 @@ private:
     bool m_DidLoop;
     int m_LoopValue = -1;
 
+    // The animation's keyed properties bound to the objects they animate in
+    // the artboard instance, along with their keyframe cursors. The animation
+    // is shared by all artboard instances so this has to live here.
+    mutable std::vector<KeyedPropertyBinding> m_Bindings;
+
 public:
     LinearAnimationInstance(const LinearAnimation*, ArtboardInstance*);
     LinearAnimationInstance(LinearAnimationInstance const&);
@@ -56,10 +62,14 @@ public:
     // Sets the animation's point in time.
     void time(float value);
 
+    // Rewinds the instance to the state it was constructed in, keeping its
+    // bindings to the artboard instance.
+    void reset();
+
     // Applies the animation instance to its artboard instance. The mix (a value
     // between 0 and 1) is the strength at which the animation is mixed with
     // other animations applied to the artboard.
-    void apply(float mix = 1.0f) const { m_Animation->apply(m_ArtboardInstance, m_Time, mix); }
+    void apply(float mix = 1.0f) const { LinearAnimation::apply(m_Bindings, m_Time, mix); }
 
     // Set when the animation is advanced, true if the animation has stopped
     // (oneShot), reached the end (loop), or changed direction (pingPong)
@@ -28,6 +28,10 @@ public:
     /// state.
     virtual bool keepGoing() const = 0;
 
+    /// Puts the state back to how it was when it was first instanced so the
+    /// State Machine can re-use it the next time the state is entered.
+    virtual void reset() = 0;
+
     const LayerState* state() const;
 };
 } // namespace rive
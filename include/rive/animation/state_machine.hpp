@@ -10,6 +10,16 @@ class StateMachineLayer;
 class StateMachineInput;
 class StateMachineListener;
 class StateMachineImporter;
+class LayerState;
+
+/// A state that reads an input, either in one of its transitions' conditions
+/// or (for blend states) to mix its animations.
+struct StateMachineInputDependent
+{
+    size_t layerIndex;
+    const LayerState* state;
+};
+
 class StateMachine : public StateMachineBase
 {
     friend class StateMachineImporter;
@@ -19,9 +29,14 @@ private:
     std::vector<std::unique_ptr<StateMachineInput>> m_Inputs;
     std::vector<std::unique_ptr<StateMachineListener>> m_Listeners;
 
+    /// Indexed by input, the states which need to be re-evaluated when that
+    /// input changes.
+    std::vector<std::vector<StateMachineInputDependent>> m_InputDependents;
+
     void addLayer(std::unique_ptr<StateMachineLayer>);
     void addInput(std::unique_ptr<StateMachineInput>);
     void addListener(std::unique_ptr<StateMachineListener>);
+    void buildInputDependents();
 
 public:
     StateMachine();
@@ -39,6 +54,9 @@ public:
     const StateMachineLayer* layer(size_t index) const;
     const StateMachineListener* listener(size_t index) const;
 
+    /// The states (across all layers) that read the input at inputIndex.
+    const std::vector<StateMachineInputDependent>& inputDependents(size_t inputIndex) const;
+
     StatusCode onAddedDirty(CoreContext* context) override;
     StatusCode onAddedClean(CoreContext* context) override;
 };
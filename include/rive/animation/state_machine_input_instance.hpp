@@ -3,6 +3,7 @@
 
 #include <string>
 #include <stdint.h>
+#include <stddef.h>
 
 namespace rive
 {
@@ -22,6 +23,8 @@ class SMIInput
 private:
     StateMachineInstance* m_MachineInstance;
     const StateMachineInput* m_Input;
+    // Index of the input in the state machine, set by the machine instance.
+    size_t m_Index = 0;
 
     virtual void advanced() {}
 
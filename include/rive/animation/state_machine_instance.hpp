@@ -6,6 +6,7 @@
 #include <vector>
 #include "rive/animation/linear_animation_instance.hpp"
 #include "rive/listener_type.hpp"
+#include "rive/math/aabb_tree.hpp"
 #include "rive/scene.hpp"
 
 namespace rive
@@ -34,11 +35,29 @@ private:
     size_t m_LayerCount;
     StateMachineLayerInstance* m_Layers;
 
+    // Layers that have settled (not mixing, waiting for an exit time, or
+    // playing an animation) are put to sleep and skipped until an input
+    // their current state reads changes.
+    size_t m_AwakeLayerCount;
+    bool m_InputChanged = false;
+    double m_ElapsedSeconds = 0.0;
+
     void markNeedsAdvance();
+    void inputChanged(const SMIInput* input);
 
     std::vector<std::unique_ptr<HitShape>> m_HitShapes;
     std::vector<NestedArtboard*> m_HitNestedArtboards;
 
+    // World bounds of m_HitShapes (by index) so pointer events only hit test
+    // the shapes near the pointer.
+    AABBTree m_HitShapeTree;
+    std::vector<uint32_t> m_HitCandidates;
+    std::vector<uint32_t> m_HoveredHitShapes;
+
+    /// Refit the hit shape tree to the shapes whose paths changed since it
+    /// was last fit.
+    void updateHitShapeBounds();
+
     /// Provide a hitListener if you want to process a down or an up for the pointer position
     /// too.
     void updateListeners(Vec2D position, ListenerType hitListener);
@@ -11,9 +11,11 @@ class StateMachineLayerImporter;
 class AnyState;
 class EntryState;
 class ExitState;
+class StateMachine;
 class StateMachineLayer : public StateMachineLayerBase
 {
     friend class StateMachineLayerImporter;
+    friend class StateMachine;
 
 private:
     std::vector<LayerState*> m_States;
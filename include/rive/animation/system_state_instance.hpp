@@ -18,6 +18,7 @@ public:
     void apply(float mix) override;
 
     bool keepGoing() const override;
+    void reset() override;
 };
 } // namespace rive
 #endif
\ No newline at end of file
@@ -7,9 +7,12 @@
 #include "rive/generated/artboard_base.hpp"
 #include "rive/hit_info.hpp"
 #include "rive/math/aabb.hpp"
+#include "rive/refcnt.hpp"
 #include "rive/renderer.hpp"
 #include "rive/shapes/shape_paint_container.hpp"
+#include "rive/span.hpp"
 
+#include <mutex>
 #include <queue>
 #include <vector>
 
@@ -26,9 +29,11 @@ class ArtboardInstance;
 class LinearAnimationInstance;
 class Scene;
 class StateMachineInstance;
+class WorkerPool;
 
 class Artboard : public ArtboardBase, public CoreContext, public ShapePaintContainer
 {
+    friend class BakedFile;
     friend class File;
     friend class ArtboardImporter;
     friend class Component;
@@ -42,7 +47,72 @@ private:
     std::vector<DrawTarget*> m_DrawTargets;
     std::vector<NestedArtboard*> m_NestedArtboards;
 
+    /// Block holding the objects of an instance made with
+    /// ObjectAllocation::arena (objects that couldn't be placed in it are
+    /// allocated individually).
+    std::unique_ptr<uint8_t[]> m_ObjectArena;
+    size_t m_ObjectArenaSize = 0;
+
+    /// The hierarchy and dependency wiring computed by initialize, which is
+    /// the same for every instance of an artboard. The source artboard builds
+    /// it and its instances share it, so they can be wired by index instead
+    /// of re-running the graph passes. A source artboard imported from a
+    /// BakedFile starts out with the template that was baked for it.
+    ///
+    /// Components are referred to by ref: object ids for the objects, and
+    /// objectCount + shapeId for the PathComposer owned by a Shape.
+    class Template : public RefCnt<Template>
+    {
+    public:
+        /// Ids of the components parented to each object, grouped by parent:
+        /// the children of object i are childIds[childOffsets[i]] up to
+        /// childOffsets[i + 1], in id order.
+        std::vector<uint32_t> childOffsets;
+        std::vector<uint32_t> childIds;
+
+        /// False when the wiring below couldn't be captured, instances then
+        /// run the full initialize.
+        bool hasWiring = false;
+        /// The dependents of the component with ref r are
+        /// dependents[dependentOffsets[r]] up to dependentOffsets[r + 1].
+        std::vector<uint32_t> dependentOffsets;
+        std::vector<uint32_t> dependents;
+        std::vector<uint32_t> dependencyOrder;
+        std::vector<uint32_t> drawables;
+        /// Id of the flattened draw rules of each drawable, 0 for none.
+        std::vector<uint32_t> drawableRules;
+        std::vector<uint32_t> drawTargets;
+    };
+    rcp<Template> m_Template;
+
     unsigned int m_DirtDepth = 0;
+
+    /// Bitset keyed by graph order of the components that have pending dirt,
+    /// lets updateComponents visit only dirty components instead of walking
+    /// the whole dependency order.
+    std::vector<uint64_t> m_DirtyComponents;
+    size_t m_FirstDirtyWord = 0;
+    size_t m_DirtyCount = 0;
+
+    /// Set by updateWorkers to update levels of the dependency graph in
+    /// parallel.
+    WorkerPool* m_UpdateWorkers = nullptr;
+    size_t m_MinParallelComponents = 0;
+    /// Graph orders of the components grouped by level: a component's level
+    /// is one more than the highest level of the components it depends on,
+    /// so nothing depends on anything in its own level. Level l is
+    /// m_LevelOrder[m_LevelStarts[l]] up to m_LevelStarts[l + 1]. Built the
+    /// first time they're needed after the dependency order is set.
+    std::vector<uint32_t> m_LevelOrder;
+    std::vector<uint32_t> m_LevelStarts;
+    std::vector<Component*> m_LevelWork;
+    /// False when the artboard has IK constraints, they update the bones of
+    /// their chain directly and those can share a level with other work.
+    bool m_CanUpdateLevelsInParallel = true;
+    /// Set while a level updates in parallel, Component::addDirt holds
+    /// m_DirtMutex then as components can dirty the same dependents.
+    bool m_UpdatingInParallel = false;
+    std::recursive_mutex m_DirtMutex;
     std::unique_ptr<RenderPath> m_BackgroundPath;
     std::unique_ptr<RenderPath> m_ClipPath;
     Factory* m_Factory = nullptr;
@@ -50,8 +120,20 @@ private:
     bool m_IsInstance = false;
     bool m_FrameOrigin = true;
 
+    void buildChildIndex(Template& tmpl);
+    void captureTemplate(Template& tmpl);
+    void applyTemplate();
+    bool acceptsTemplate(const Template& tmpl) const;
+    bool hasTemplateRef(uint32_t ref) const;
+    Component* templateComponent(uint32_t ref) const;
     void sortDependencies();
+    void prepareDependencyOrder();
     void sortDrawOrder();
+    void markComponentDirty(unsigned int graphOrder);
+    int popDirtyComponent();
+    void buildUpdateLevels();
+    void updateLevels();
+    bool inObjectArena(const Core* object) const;
 
     Artboard* getArtboard() override { return this; }
 
@@ -75,6 +157,14 @@ public:
     /// itself has id 0 so we use that as a flag for not found.
     uint32_t idOf(Core* object) const;
 
+    /// Ids of the components directly parented to the object with the given
+    /// id. Available from onAddedClean on.
+    Span<const uint32_t> childIds(uint32_t id) const;
+
+    /// Appends the id and the ids of everything parented under it (at any
+    /// depth) to ids, then sorts them. Available from onAddedClean on.
+    void subtreeIds(uint32_t id, std::vector<uint32_t>& ids) const;
+
     Factory* factory() const { return m_Factory; }
 
     // EXPERIMENTAL -- for internal testing only for now.
@@ -85,6 +175,21 @@ public:
 
     /// Update components that depend on each other in DAG order.
     bool updateComponents();
+
+    /// Updates components on workers (or serially again when null) from now
+    /// on: updateComponents goes through the dependency graph a level at a
+    /// time, splitting the dirty components of a level across the workers
+    /// when there are at least minComponents of them. Updates with fewer
+    /// dirty components in all run serially as before. The results are the
+    /// same either way.
+    ///
+    /// Components can make render objects from the artboard's factory on any
+    /// of the workers, so it has to support being called concurrently.
+    /// Nested artboards and artboards with IK constraints still update
+    /// serially. Handing work to the workers has a cost of its own, the
+    /// default only splits levels that are wide enough to make up for it.
+    void updateWorkers(WorkerPool* workers, size_t minComponents = 1024);
+    WorkerPool* updateWorkers() const { return m_UpdateWorkers; }
     void update(ComponentDirt value) override;
     void onDirty(ComponentDirt dirt) override;
 
@@ -143,10 +248,29 @@ public:
     // provided.
     int defaultStateMachineIndex() const;
 
+    /// How instance() allocates the copies of the artboard's objects.
+    enum class ObjectAllocation
+    {
+        /// Each object gets its own heap allocation.
+        individual,
+        /// The objects are laid out consecutively (in id order) in a single
+        /// block sized from this artboard, freed at once with the instance.
+        arena,
+    };
+
     /// Make an instance of this artboard, must be explictly deleted when no
     /// longer needed.
     // Deprecated...
-    std::unique_ptr<ArtboardInstance> instance() const;
+    std::unique_ptr<ArtboardInstance> instance(
+        ObjectAllocation allocation = ObjectAllocation::arena) const;
+
+    /// Return an instance made by this artboard to the state it was made
+    /// in, without re-allocating its objects: every property of every object
+    /// is copied back from this artboard (whether an animation or the app
+    /// changed it), everything is marked dirty, and nested artboards are reset
+    /// along with their animations. Returns false if the instance wasn't made
+    /// from this artboard.
+    bool resetInstance(ArtboardInstance* instance) const;
 
     /// Returns true if the artboard is an instance of another
     bool isInstance() const { return m_IsInstance; }
@@ -0,0 +1,38 @@
+#ifndef _RIVE_ARTBOARD_POOL_HPP_
+#define _RIVE_ARTBOARD_POOL_HPP_
+
+#include "rive/artboard.hpp"
+#include <memory>
+#include <vector>
+
+namespace rive
+{
+/// Recycles the instances of an artboard. Instances released to the pool are
+/// reset to the artboard's state (see Artboard::resetInstance) and handed
+/// out again by acquire instead of making new ones. The artboard must outlive
+/// the pool.
+class ArtboardPool
+{
+private:
+    const Artboard* m_Artboard;
+    size_t m_MaxIdle;
+    std::vector<std::unique_ptr<ArtboardInstance>> m_Idle;
+
+public:
+    /// Keeps at most maxIdle released instances around, the rest are deleted.
+    explicit ArtboardPool(const Artboard* artboard, size_t maxIdle = 64);
+
+    const Artboard* artboard() const { return m_Artboard; }
+
+    /// A released instance if there is one, otherwise a new instance.
+    std::unique_ptr<ArtboardInstance> acquire();
+
+    /// Give an instance of the pool's artboard back to the pool. Instances of
+    /// other artboards are deleted.
+    void release(std::unique_ptr<ArtboardInstance> instance);
+
+    size_t idleCount() const { return m_Idle.size(); }
+};
+} // namespace rive
+
+#endif
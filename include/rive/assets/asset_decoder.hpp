@@ -0,0 +1,43 @@
+#ifndef _RIVE_ASSET_DECODER_HPP_
+#define _RIVE_ASSET_DECODER_HPP_
+
+#include "rive/file_asset_resolver.hpp"
+#include "rive/span.hpp"
+#include <condition_variable>
+#include <mutex>
+
+namespace rive
+{
+class Factory;
+class FileAsset;
+class WorkerPool;
+
+/// Decodes a file's assets on a WorkerPool, keeping track of the decodes (and
+/// asynchronous loads) that haven't finished so the file can wait for them
+/// before its assets go away.
+class AssetDecoder : public FileAssetResolver::Completion
+{
+private:
+    WorkerPool* m_Workers;
+    Factory* m_Factory;
+    std::mutex m_Mutex;
+    std::condition_variable m_Finished;
+    size_t m_Pending = 0;
+
+public:
+    AssetDecoder(WorkerPool* workers, Factory* factory);
+    ~AssetDecoder() override;
+
+    /// Queues decoding contents into asset, the contents have to stay valid
+    /// until it's done.
+    void decode(FileAsset* asset, Span<const uint8_t> contents);
+
+    /// Counts a load that's started, complete is called when it's done.
+    Completion* startLoad();
+    void complete() override;
+
+    /// Blocks until every decode and load has finished.
+    void wait();
+};
+} // namespace rive
+#endif
@@ -8,9 +8,12 @@ namespace rive
 class FileAssetContents : public FileAssetContentsBase
 {
 private:
-    std::vector<uint8_t> m_Bytes;
+    Span<const uint8_t> m_Bytes;
 
 public:
+    /// The contents point into the bytes the file is imported from, they're
+    /// only valid while the file is imported unless the File retains its
+    /// bytes (see File::import).
     Span<const uint8_t> bytes() const;
     StatusCode import(ImportStack& importStack) override;
     void decodeBytes(Span<const uint8_t> value) override;
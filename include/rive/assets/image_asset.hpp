@@ -3,6 +3,7 @@
 
 #include "rive/generated/assets/image_asset_base.hpp"
 #include "rive/renderer.hpp"
+#include <atomic>
 #include <string>
 
 namespace rive
@@ -10,7 +11,9 @@ namespace rive
 class ImageAsset : public ImageAssetBase
 {
 private:
-    std::unique_ptr<RenderImage> m_RenderImage;
+    // Owned, atomic as it may be decoded on another thread (see
+    // FileAssetResolver::loadContentsAsync).
+    std::atomic<RenderImage*> m_RenderImage{nullptr};
 
 public:
     ImageAsset() {}
@@ -21,7 +24,8 @@ public:
 #endif
     bool decode(Span<const uint8_t>, Factory*) override;
     std::string fileExtension() override;
-    RenderImage* renderImage() const { return m_RenderImage.get(); }
+    /// Null until the image has been decoded.
+    RenderImage* renderImage() const { return m_RenderImage.load(std::memory_order_acquire); }
     void renderImage(std::unique_ptr<RenderImage> renderImage);
 };
 } // namespace rive
@@ -0,0 +1,55 @@
+#ifndef _RIVE_BAKED_FILE_HPP_
+#define _RIVE_BAKED_FILE_HPP_
+
+#include "rive/artboard.hpp"
+#include "rive/file.hpp"
+#include "rive/span.hpp"
+#include <vector>
+
+namespace rive
+{
+///
+/// A Rive file packaged with what initializing its artboards works out: the
+/// hierarchy, dependency graph and order, draw order, and draw rule links of
+/// each artboard. File::import recognizes baked files and wires their
+/// artboards from the baked tables instead of sorting their graphs.
+///
+/// Layout, every field a little endian uint32 and every table 4 byte
+/// aligned (so the bytes can be mapped and read in place):
+///   magic "RIVB", bake version, runtime major and minor version, offset
+///   and size of the .riv bytes, checksum of the tables, artboard count,
+///   then for each artboard a flags word followed by its tables (each a
+///   count and that many words), then the .riv bytes.
+///
+/// The tables are only valid for the runtime version that baked them, files
+/// baked by another version are rejected as unsupported.
+///
+class BakedFile
+{
+public:
+    /// Changes whenever the layout or what initialize computes does.
+    static const uint32_t version = 1;
+
+    /// @returns whether data starts like a baked file.
+    static bool isBaked(Span<const uint8_t> data);
+
+    /// Imports the .riv file in data and bakes it.
+    /// @param factory is only used to import the file, any will do.
+    /// @param result is an optional status result.
+    /// @returns the baked file, empty on failure.
+    static std::vector<uint8_t> bake(Span<const uint8_t> data,
+                                     Factory* factory,
+                                     ImportResult* result = nullptr);
+
+private:
+    friend class File;
+
+    /// Validates a baked file and reads its tables, riv is set to the .riv
+    /// bytes it holds.
+    static ImportResult read(Span<const uint8_t> data,
+                             Span<const uint8_t>& riv,
+                             std::vector<rcp<Artboard::Template>>& templates);
+};
+} // namespace rive
+
+#endif
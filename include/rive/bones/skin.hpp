@@ -31,6 +31,7 @@ protected:
 public:
     StatusCode onAddedClean(CoreContext* context) override;
     void buildDependencies() override;
+    void onResolved() override;
     void deform(Span<Vertex*> vertices);
     void onDirty(ComponentDirt dirt) override;
     void update(ComponentDirt value) override;
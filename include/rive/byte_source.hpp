@@ -0,0 +1,31 @@
+#ifndef _RIVE_BYTE_SOURCE_HPP_
+#define _RIVE_BYTE_SOURCE_HPP_
+
+#include "rive/refcnt.hpp"
+#include "rive/span.hpp"
+#include <vector>
+
+namespace rive
+{
+/// Ref counted, immutable bytes. A File imported from a ByteSource keeps a
+/// reference to it and points into it instead of copying what it needs.
+class ByteSource : public RefCnt<ByteSource>
+{
+public:
+    virtual ~ByteSource() {}
+    virtual Span<const uint8_t> bytes() const = 0;
+
+    /// Takes ownership of bytes.
+    static rcp<ByteSource> make(std::vector<uint8_t> bytes);
+
+    /// References bytes owned by the caller, who must keep them alive (and
+    /// unchanged) until the ByteSource is released.
+    static rcp<ByteSource> makeUnowned(Span<const uint8_t> bytes);
+
+    /// Maps the file at path into memory (or reads it on platforms without
+    /// mmap). Returns null if the file can't be opened.
+    static rcp<ByteSource> mapFile(const char* path);
+};
+} // namespace rive
+
+#endif
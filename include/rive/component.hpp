@@ -13,12 +13,23 @@ class Artboard;
 class Component : public ComponentBase
 {
     friend class Artboard;
+    friend class DependencySorter;
 
 private:
     ContainerComponent* m_Parent = nullptr;
     std::vector<Component*> m_Dependents;
 
-    unsigned int m_GraphOrder;
+    unsigned int m_GraphOrder = 0;
+
+    /// Scratch state for passes over the dependency graph, always left as
+    /// none when they're done.
+    enum class SortMark : uint8_t
+    {
+        none,
+        visiting,
+        sorted
+    };
+    SortMark m_SortMark = SortMark::none;
     Artboard* m_Artboard = nullptr;
 
 protected:
@@ -29,6 +40,9 @@ public:
     StatusCode onAddedDirty(CoreContext* context) override;
     inline ContainerComponent* parent() const { return m_Parent; }
     const std::vector<Component*>& dependents() const { return m_Dependents; }
+    /// Adds component as a dependent. Duplicates are allowed here (checking
+    /// for them is quadratic for wide hierarchies), the artboard drops them
+    /// when it sorts its dependencies.
     void addDependent(Component* component);
 
     // TODO: re-evaluate when more of the lib is complete...
@@ -36,6 +50,11 @@ public:
     // having to implement them in a bunch of concrete classes that
     // currently don't use this logic.
     virtual void buildDependencies() {}
+    /// Called once all objects have been added clean, before the dependency
+    /// graph is built (or copied from the artboard's template). Set up state
+    /// that needs resolved references here, buildDependencies should only add
+    /// edges as instances may skip it.
+    virtual void onResolved() {}
     virtual void onDirty(ComponentDirt dirt) {}
     virtual void update(ComponentDirt value) {}
 
@@ -28,6 +28,20 @@ public:
     /// Make a shallow copy of the object.
     virtual Core* clone() const { return nullptr; }
 
+    /// Number of bytes cloneInto needs, 0 if the object can't be cloned.
+    virtual size_t cloneSize() const { return 0; }
+
+    /// Make a shallow copy of the object in memory, which must hold
+    /// cloneSize() bytes and be aligned for any type. The copy doesn't own
+    /// its memory, so it must be destroyed by calling its destructor rather
+    /// than deleted.
+    virtual Core* cloneInto(void* memory) const { return nullptr; }
+
+    /// Set every property to source's value, which must be the same type.
+    /// Properties that differ go through their change callbacks, as if they'd
+    /// been set one at a time. Encoded properties are left alone.
+    virtual void assignProperties(const Core* source) {}
+
     template <typename T> inline const T* as() const
     {
         assert(is<T>());
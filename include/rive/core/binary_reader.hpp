@@ -3,7 +3,10 @@
 #define _RIVE_CORE_BINARY_READER_HPP_
 
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
+#include "rive/shared_string.hpp"
 #include "rive/span.hpp"
 #include "rive/core/type_conversions.hpp"
 
@@ -17,8 +20,12 @@ private:
     bool m_Overflowed;
     bool m_IntRangeError;
 
+    /// Strings read with readSharedString, keyed by their bytes in m_Bytes.
+    std::unordered_map<std::string_view, SharedString> m_SharedStrings;
+
     void overflow();
     void intRangeError();
+    uint64_t readMultiByteVarUint64();
 
 public:
     explicit BinaryReader(Span<const uint8_t>);
@@ -31,11 +38,31 @@ public:
     const uint8_t* position() const;
 
     std::string readString();
+    /// Like readString, but equal strings read from the same reader share
+    /// their characters.
+    SharedString readSharedString();
+    /// The returned bytes point into the reader's bytes, they're not copied.
     Span<const uint8_t> readBytes();
     float readFloat32();
     uint8_t readByte();
     uint32_t readUint32();
-    uint64_t readVarUint64(); // Reads a LEB128 encoded uint64_t
+    /// Reads a LEB128 encoded uint64_t.
+    uint64_t readVarUint64()
+    {
+        // Most values (property keys, type keys, ids, small counts) fit in a
+        // single byte.
+        if (m_Position != m_Bytes.end() && *m_Position < 0x80)
+        {
+            return *m_Position++;
+        }
+        return readMultiByteVarUint64();
+    }
+    /// Reads LEB128 encoded values until the end of the bytes, appending them
+    /// to values. Values that don't fit in a uint16_t set the int range error.
+    void readVarUint16s(std::vector<uint16_t>& values);
+    /// The next LEB128 encoded uint64_t, without moving past it. Returns 0 if
+    /// there isn't one.
+    uint64_t peekVarUint64() const;
 
     // This will cast the uint read to the requested size, but if the
     // raw value was out-of-range, instead returns 0 and sets the IntRangeError.
@@ -4,9 +4,13 @@
 namespace rive
 {
 class BinaryReader;
+class Core;
 class CoreBoolType
 {
 public:
+    typedef void (*Setter)(Core*, bool);
+    typedef bool (*Getter)(Core*);
+
     static const int id = 0;
     static bool deserialize(BinaryReader& reader);
 };
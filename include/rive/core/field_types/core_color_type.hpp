@@ -4,9 +4,13 @@
 namespace rive
 {
 class BinaryReader;
+class Core;
 class CoreColorType
 {
 public:
+    typedef void (*Setter)(Core*, int);
+    typedef int (*Getter)(Core*);
+
     static const int id = 3;
     static int deserialize(BinaryReader& reader);
 };
@@ -4,9 +4,13 @@
 namespace rive
 {
 class BinaryReader;
+class Core;
 class CoreDoubleType
 {
 public:
+    typedef void (*Setter)(Core*, float);
+    typedef float (*Getter)(Core*);
+
     static const int id = 2;
     static float deserialize(BinaryReader& reader);
 };
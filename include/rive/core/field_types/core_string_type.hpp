@@ -1,16 +1,21 @@
 #ifndef _RIVE_CORE_STRING_TYPE_HPP_
 #define _RIVE_CORE_STRING_TYPE_HPP_
 
+#include "rive/shared_string.hpp"
 #include <string>
 
 namespace rive
 {
 class BinaryReader;
+class Core;
 class CoreStringType
 {
 public:
+    typedef void (*Setter)(Core*, std::string);
+    typedef std::string (*Getter)(Core*);
+
     static const int id = 1;
-    static std::string deserialize(BinaryReader& reader);
+    static SharedString deserialize(BinaryReader& reader);
 };
 } // namespace rive
 #endif
\ No newline at end of file
@@ -1,12 +1,18 @@
 #ifndef _RIVE_CORE_UINT_TYPE_HPP_
 #define _RIVE_CORE_UINT_TYPE_HPP_
 
+#include <stdint.h>
+
 namespace rive
 {
 class BinaryReader;
+class Core;
 class CoreUintType
 {
 public:
+    typedef void (*Setter)(Core*, uint32_t);
+    typedef uint32_t (*Getter)(Core*);
+
     static const int id = 0;
     static unsigned int deserialize(BinaryReader& reader);
 };
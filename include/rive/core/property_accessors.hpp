@@ -0,0 +1,28 @@
+#ifndef _RIVE_PROPERTY_ACCESSORS_HPP_
+#define _RIVE_PROPERTY_ACCESSORS_HPP_
+
+#include "rive/core/field_types/core_bool_type.hpp"
+#include "rive/core/field_types/core_color_type.hpp"
+#include "rive/core/field_types/core_double_type.hpp"
+#include "rive/core/field_types/core_uint_type.hpp"
+
+namespace rive
+{
+/// Typed getters/setters for a single property key. They're resolved from the
+/// CoreRegistry once so that animating a property doesn't have to switch on
+/// its key every time it's applied. Accessors for types the property doesn't
+/// have (or for keys this runtime doesn't know about) are null.
+struct PropertyAccessors
+{
+    CoreDoubleType::Setter setDouble = nullptr;
+    CoreDoubleType::Getter getDouble = nullptr;
+    CoreColorType::Setter setColor = nullptr;
+    CoreColorType::Getter getColor = nullptr;
+    CoreBoolType::Setter setBool = nullptr;
+    CoreUintType::Setter setUint = nullptr;
+
+    static PropertyAccessors resolve(int propertyKey);
+};
+} // namespace rive
+
+#endif
@@ -12,7 +12,8 @@ static bool is_big_endian(void)
     return bint.c[0] == 1;
 }
 
-/* Decode an unsigned int LEB128 at buf into r, returning the nr of bytes read.
+/* Decode an unsigned int LEB128 at buf into r, returning the nr of bytes read
+ * (0 if it runs past buf_end or is longer than a uint64_t can be).
  */
 inline size_t decode_uint_leb(const uint8_t* buf, const uint8_t* buf_end, uint64_t* r)
 {
@@ -23,7 +24,7 @@ inline size_t decode_uint_leb(const uint8_t* buf, const uint8_t* buf_end, uint64
 
     do
     {
-        if (p >= buf_end)
+        if (p >= buf_end || shift >= 70)
         {
             return 0;
         }
@@ -1,7 +1,7 @@
 #ifndef _RIVE_DEPENDENCYSORTER_HPP_
 #define _RIVE_DEPENDENCYSORTER_HPP_
 
-#include <unordered_set>
+#include <stddef.h>
 #include <vector>
 
 namespace rive
@@ -10,13 +10,19 @@ class Component;
 class DependencySorter
 {
 private:
-    std::unordered_set<Component*> m_Perm;
-    std::unordered_set<Component*> m_Temp;
+    struct Frame
+    {
+        Component* component;
+        size_t nextDependent;
+    };
+    std::vector<Frame> m_Stack;
 
 public:
+    /// Fills order with root and everything that depends on it such that
+    /// each component comes before its dependents. Stops (keeping what
+    /// was ordered so far) if it finds a cycle.
     void sort(Component* root, std::vector<Component*>& order);
-    bool visit(Component* component, std::vector<Component*>& order);
 };
 } // namespace rive
 
-#endif
\ No newline at end of file
+#endif
@@ -60,6 +60,10 @@ public:
 
     virtual rcp<Font> decodeFont(Span<const uint8_t>) { return nullptr; }
 
+    // Whether decodeImage can be called from other threads while the factory
+    // is in use, which lets files decode their images in the background.
+    virtual bool canDecodeConcurrently() const { return false; }
+
     // Non-virtual helpers
 
     std::unique_ptr<RenderPath> makeRenderPath(const AABB&);
@@ -3,8 +3,10 @@
 
 #include "rive/artboard.hpp"
 #include "rive/backboard.hpp"
+#include "rive/byte_source.hpp"
 #include "rive/factory.hpp"
 #include "rive/file_asset_resolver.hpp"
+#include <mutex>
 #include <vector>
 #include <set>
 
@@ -13,8 +15,11 @@
 ///
 namespace rive
 {
+class AssetDecoder;
 class BinaryReader;
+class ImportStack;
 class RuntimeHeader;
+class WorkerPool;
 class Factory;
 
 ///
@@ -30,11 +35,34 @@ enum class ImportResult
     malformed
 };
 
+///
+/// When the artboards in a Rive file are imported.
+///
+enum class ArtboardLoading
+{
+    /// Every artboard is imported when the file is.
+    eager,
+    /// Importing the file only indexes the artboards' objects, each artboard
+    /// is imported the first time it's asked for (names are available right
+    /// away).
+    lazy
+};
+
 ///
 /// A Rive file.
 ///
+/// A const File can be used from multiple threads at once: its artboards can
+/// be looked up and instanced (along with their animations and state
+/// machines) concurrently, lazily loaded artboards are loaded once by
+/// whichever thread asks for them first. The factory must then support being
+/// called concurrently too. Instances themselves aren't shared, each one
+/// should only be used by one thread at a time.
+///
 class File
 {
+    friend class BakedFile;
+    friend class StreamingFileImporter;
+
 public:
     /// Major version number supported by the runtime.
     static const int majorVersion = 7;
@@ -59,13 +87,58 @@ private:
     /// with the file.
     FileAssetResolver* m_AssetResolver;
 
+    /// The bytes the file was imported from, when it retains them.
+    rcp<ByteSource> m_Source;
+
+    /// Decodes assets in the background when the file is imported with a
+    /// WorkerPool.
+    std::unique_ptr<AssetDecoder> m_AssetDecoder;
+
+    /// An artboard imported with ArtboardLoading::lazy, objects are the bytes
+    /// of the objects that follow the artboard in the file and objectCount how
+    /// many of them there are (so the artboard can reserve room for them).
+    struct LazyArtboard
+    {
+        enum class State
+        {
+            unloaded,
+            loading,
+            loaded,
+            failed
+        };
+        Span<const uint8_t> objects;
+        uint32_t objectCount;
+        State state;
+    };
+    ArtboardLoading m_ArtboardLoading = ArtboardLoading::eager;
+    std::unique_ptr<RuntimeHeader> m_Header;
+    /// Matches m_Artboards, empty when the artboards aren't lazy.
+    mutable std::vector<LazyArtboard> m_LazyArtboards;
+    /// Held while looking up or loading a lazy artboard. Recursive as loading
+    /// an artboard loads the artboards it nests.
+    mutable std::recursive_mutex m_LazyArtboardsMutex;
+    /// The templates baked for each of m_Artboards when the file was imported
+    /// from a BakedFile, installed on the artboards as they're imported.
+    std::vector<rcp<Artboard::Template>> m_BakedTemplates;
+    /// Index in m_Artboards of each artboard id (-1 for artboards that failed
+    /// to import), used to resolve nested artboards when lazily loading.
+    std::vector<int> m_ArtboardIds;
+
     File(Factory*, FileAssetResolver*);
 
+    static std::unique_ptr<File> import(Span<const uint8_t> data,
+                                        rcp<ByteSource> source,
+                                        ArtboardLoading loading,
+                                        WorkerPool* workers,
+                                        Factory*,
+                                        ImportResult* result,
+                                        FileAssetResolver* assetResolver);
+
 public:
     ~File();
 
     ///
-    /// Imports a Rive file from a binary buffer.
+    /// Imports a Rive file (or a BakedFile) from a binary buffer.
     /// @param data the raw date of the file.
     /// @param result is an optional status result.
     /// @param assetResolver is an optional helper to resolve assets which
@@ -76,6 +149,33 @@ public:
                                         ImportResult* result = nullptr,
                                         FileAssetResolver* assetResolver = nullptr);
 
+    ///
+    /// Imports a Rive file (or a BakedFile) from a byte source the file keeps
+    /// a reference to, so data it loads (like the contents of in-band assets)
+    /// can point into it instead of being copied.
+    /// @param source the raw data of the file.
+    /// @param result is an optional status result.
+    /// @param assetResolver is an optional helper to resolve assets which
+    /// cannot be found in-band.
+    /// @param loading whether artboards are imported now or when they're
+    /// first asked for.
+    /// @param workers is an optional pool to import eagerly loaded artboards
+    /// across, in which case the factory must be safe to use from multiple
+    /// threads. When the factory can decode concurrently the file's images
+    /// are also decoded on the workers, after this returns (they draw nothing
+    /// until they're ready, see waitForAssets).
+    /// @returns a pointer to the file, or null on failure.
+    static std::unique_ptr<File> import(rcp<ByteSource> source,
+                                        Factory*,
+                                        ImportResult* result = nullptr,
+                                        FileAssetResolver* assetResolver = nullptr,
+                                        ArtboardLoading loading = ArtboardLoading::eager,
+                                        WorkerPool* workers = nullptr);
+
+    /// @returns the bytes the file was imported from if it retains them, null
+    /// otherwise.
+    const ByteSource* source() const { return m_Source.get(); }
+
     /// @returns the file's backboard. All files have exactly one backboard.
     Backboard* backboard() const { return m_Backboard.get(); }
 
@@ -85,6 +185,10 @@ public:
 
     std::vector<const FileAsset*> assets() const;
 
+    /// Blocks until the assets being decoded in the background (if any) are
+    /// ready.
+    void waitForAssets() const;
+
     // Instances
     std::unique_ptr<ArtboardInstance> artboardDefault() const;
     std::unique_ptr<ArtboardInstance> artboardAt(size_t index) const;
@@ -112,7 +216,41 @@ public:
 #endif
 
 private:
+    /// Reads a single object from the file, null if it's of a type this
+    /// runtime doesn't know or it couldn't be read.
+    static Core* readRuntimeObject(BinaryReader&, const RuntimeHeader&);
+    /// Moves past a single object without making it, returns false if its
+    /// properties couldn't be read.
+    static bool skipRuntimeObject(BinaryReader&, const RuntimeHeader&);
+    /// Whether objects of this type belong to the file rather than to the
+    /// artboard before them.
+    static bool isFileObject(uint64_t typeKey);
+
     ImportResult read(BinaryReader&, const RuntimeHeader&);
+    ImportResult readObjects(BinaryReader&, const RuntimeHeader&, ImportStack&);
+    /// Imports a single object read from the file, taking ownership of it.
+    ImportResult importObject(Core* object, ImportStack&);
+    /// Imports an artboard object and indexes its objects to be imported
+    /// later. Returns false (and deletes the artboard) if it didn't import.
+    bool addLazyArtboard(Core* artboard,
+                         Span<const uint8_t> objects,
+                         uint32_t objectCount,
+                         ImportStack&);
+    /// Takes ownership of an imported artboard.
+    void addArtboard(Artboard* artboard);
+
+    /// Imports the objects of a lazy artboard if it hasn't been yet, returns
+    /// the artboard or null if it couldn't be imported.
+    Artboard* loadArtboard(size_t index) const;
+    /// Imports and initializes an indexed artboard's objects, doesn't touch
+    /// anything outside of the artboard so artboards can be imported
+    /// concurrently.
+    bool importArtboardObjects(size_t index) const;
+    /// Nests the artboards that the artboard at index nests, loading them if
+    /// needed.
+    void nestArtboards(size_t index) const;
+    /// Loads every indexed artboard, importing them across the workers.
+    ImportResult loadArtboards(WorkerPool* workers);
 };
 } // namespace rive
 #endif
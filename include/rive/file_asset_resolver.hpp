@@ -10,6 +10,16 @@ class FileAsset;
 class FileAssetResolver
 {
 public:
+    /// Told when an asynchronous load is done.
+    class Completion
+    {
+    public:
+        virtual ~Completion() {}
+        /// Call once the asset's contents have been loaded (or couldn't be),
+        /// from any thread. The asset may be destroyed after this returns.
+        virtual void complete() = 0;
+    };
+
     virtual ~FileAssetResolver() {}
 
     /// Expected to be overridden to find asset contents when not provided
@@ -17,6 +27,19 @@ public:
     /// @param asset describes the asset that Rive is looking for the
     /// contents of.
     virtual void loadContents(FileAsset& asset) = 0;
+
+    /// Used instead of loadContents when the file decodes its assets in the
+    /// background (see File::import), so the contents can be found and decoded
+    /// off of the thread importing the file. By default this loads them
+    /// synchronously.
+    /// @param asset describes the asset that Rive is looking for the
+    /// contents of.
+    /// @param completion must be told when the load is done.
+    virtual void loadContentsAsync(FileAsset& asset, Completion* completion)
+    {
+        loadContents(asset);
+        completion->complete();
+    }
 };
 } // namespace rive
 #endif
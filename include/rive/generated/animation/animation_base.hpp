@@ -1,8 +1,8 @@
 #ifndef _RIVE_ANIMATION_BASE_HPP_
 #define _RIVE_ANIMATION_BASE_HPP_
-#include <string>
 #include "rive/core.hpp"
 #include "rive/core/field_types/core_string_type.hpp"
+#include "rive/shared_string.hpp"
 namespace rive
 {
 class AnimationBase : public Core
@@ -31,7 +31,7 @@ public:
     static const uint16_t namePropertyKey = 55;
 
 private:
-    std::string m_Name = "";
+    SharedString m_Name = "";
 
 public:
     inline const std::string& name() const { return m_Name; }
@@ -46,8 +46,20 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const AnimationBase& object) { m_Name = object.m_Name; }
 
+    void assign(const AnimationBase& object)
+    {
+        if (m_Name != object.m_Name)
+        {
+            m_Name = object.m_Name;
+            nameChanged();
+        }
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
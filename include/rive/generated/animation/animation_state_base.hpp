@@ -47,12 +47,25 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const AnimationStateBase& object)
     {
         m_AnimationId = object.m_AnimationId;
         LayerState::copy(object);
     }
 
+    void assign(const AnimationStateBase& object)
+    {
+        if (m_AnimationId != object.m_AnimationId)
+        {
+            m_AnimationId = object.m_AnimationId;
+            animationIdChanged();
+        }
+        LayerState::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
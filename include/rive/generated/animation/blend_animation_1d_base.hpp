@@ -46,12 +46,25 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const BlendAnimation1DBase& object)
     {
         m_Value = object.m_Value;
         BlendAnimation::copy(object);
     }
 
+    void assign(const BlendAnimation1DBase& object)
+    {
+        if (m_Value != object.m_Value)
+        {
+            m_Value = object.m_Value;
+            valueChanged();
+        }
+        BlendAnimation::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
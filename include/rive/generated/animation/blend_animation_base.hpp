@@ -46,6 +46,15 @@ public:
 
     void copy(const BlendAnimationBase& object) { m_AnimationId = object.m_AnimationId; }
 
+    void assign(const BlendAnimationBase& object)
+    {
+        if (m_AnimationId != object.m_AnimationId)
+        {
+            m_AnimationId = object.m_AnimationId;
+            animationIdChanged();
+        }
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -46,12 +46,25 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const BlendAnimationDirectBase& object)
     {
         m_InputId = object.m_InputId;
         BlendAnimation::copy(object);
     }
 
+    void assign(const BlendAnimationDirectBase& object)
+    {
+        if (m_InputId != object.m_InputId)
+        {
+            m_InputId = object.m_InputId;
+            inputIdChanged();
+        }
+        BlendAnimation::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -48,12 +48,25 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const BlendState1DBase& object)
     {
         m_InputId = object.m_InputId;
         BlendState::copy(object);
     }
 
+    void assign(const BlendState1DBase& object)
+    {
+        if (m_InputId != object.m_InputId)
+        {
+            m_InputId = object.m_InputId;
+            inputIdChanged();
+        }
+        BlendState::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
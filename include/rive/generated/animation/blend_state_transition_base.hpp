@@ -47,12 +47,25 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const BlendStateTransitionBase& object)
     {
         m_ExitBlendAnimationId = object.m_ExitBlendAnimationId;
         StateTransition::copy(object);
     }
 
+    void assign(const BlendStateTransitionBase& object)
+    {
+        if (m_ExitBlendAnimationId != object.m_ExitBlendAnimationId)
+        {
+            m_ExitBlendAnimationId = object.m_ExitBlendAnimationId;
+            exitBlendAnimationIdChanged();
+        }
+        StateTransition::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -84,6 +84,9 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const CubicInterpolatorBase& object)
     {
         m_X1 = object.m_X1;
@@ -92,6 +95,30 @@ public:
         m_Y2 = object.m_Y2;
     }
 
+    void assign(const CubicInterpolatorBase& object)
+    {
+        if (m_X1 != object.m_X1)
+        {
+            m_X1 = object.m_X1;
+            x1Changed();
+        }
+        if (m_Y1 != object.m_Y1)
+        {
+            m_Y1 = object.m_Y1;
+            y1Changed();
+        }
+        if (m_X2 != object.m_X2)
+        {
+            m_X2 = object.m_X2;
+            x2Changed();
+        }
+        if (m_Y2 != object.m_Y2)
+        {
+            m_Y2 = object.m_Y2;
+            y2Changed();
+        }
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -45,8 +45,20 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const KeyedObjectBase& object) { m_ObjectId = object.m_ObjectId; }
 
+    void assign(const KeyedObjectBase& object)
+    {
+        if (m_ObjectId != object.m_ObjectId)
+        {
+            m_ObjectId = object.m_ObjectId;
+            objectIdChanged();
+        }
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -45,8 +45,20 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const KeyedPropertyBase& object) { m_PropertyKey = object.m_PropertyKey; }
 
+    void assign(const KeyedPropertyBase& object)
+    {
+        if (m_PropertyKey != object.m_PropertyKey)
+        {
+            m_PropertyKey = object.m_PropertyKey;
+            propertyKeyChanged();
+        }
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
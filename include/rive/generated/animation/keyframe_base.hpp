@@ -77,6 +77,25 @@ public:
         m_InterpolatorId = object.m_InterpolatorId;
     }
 
+    void assign(const KeyFrameBase& object)
+    {
+        if (m_Frame != object.m_Frame)
+        {
+            m_Frame = object.m_Frame;
+            frameChanged();
+        }
+        if (m_InterpolationType != object.m_InterpolationType)
+        {
+            m_InterpolationType = object.m_InterpolationType;
+            interpolationTypeChanged();
+        }
+        if (m_InterpolatorId != object.m_InterpolatorId)
+        {
+            m_InterpolatorId = object.m_InterpolatorId;
+            interpolatorIdChanged();
+        }
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -46,12 +46,25 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const KeyFrameBoolBase& object)
     {
         m_Value = object.m_Value;
         KeyFrame::copy(object);
     }
 
+    void assign(const KeyFrameBoolBase& object)
+    {
+        if (m_Value != object.m_Value)
+        {
+            m_Value = object.m_Value;
+            valueChanged();
+        }
+        KeyFrame::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
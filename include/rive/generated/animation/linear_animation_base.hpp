@@ -126,6 +126,9 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const LinearAnimationBase& object)
     {
         m_Fps = object.m_Fps;
@@ -138,6 +141,46 @@ public:
         Animation::copy(object);
     }
 
+    void assign(const LinearAnimationBase& object)
+    {
+        if (m_Fps != object.m_Fps)
+        {
+            m_Fps = object.m_Fps;
+            fpsChanged();
+        }
+        if (m_Duration != object.m_Duration)
+        {
+            m_Duration = object.m_Duration;
+            durationChanged();
+        }
+        if (m_Speed != object.m_Speed)
+        {
+            m_Speed = object.m_Speed;
+            speedChanged();
+        }
+        if (m_LoopValue != object.m_LoopValue)
+        {
+            m_LoopValue = object.m_LoopValue;
+            loopValueChanged();
+        }
+        if (m_WorkStart != object.m_WorkStart)
+        {
+            m_WorkStart = object.m_WorkStart;
+            workStartChanged();
+        }
+        if (m_WorkEnd != object.m_WorkEnd)
+        {
+            m_WorkEnd = object.m_WorkEnd;
+            workEndChanged();
+        }
+        if (m_EnableWorkArea != object.m_EnableWorkArea)
+        {
+            m_EnableWorkArea = object.m_EnableWorkArea;
+            enableWorkAreaChanged();
+        }
+        Animation::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
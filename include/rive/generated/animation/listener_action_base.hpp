@@ -28,6 +28,8 @@ public:
 
     void copy(const ListenerActionBase& object) {}
 
+    void assign(const ListenerActionBase& object) {}
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override { return false; }
 
 protected:
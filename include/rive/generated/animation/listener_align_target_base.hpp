@@ -46,12 +46,25 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const ListenerAlignTargetBase& object)
     {
         m_TargetId = object.m_TargetId;
         ListenerAction::copy(object);
     }
 
+    void assign(const ListenerAlignTargetBase& object)
+    {
+        if (m_TargetId != object.m_TargetId)
+        {
+            m_TargetId = object.m_TargetId;
+            targetIdChanged();
+        }
+        ListenerAction::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
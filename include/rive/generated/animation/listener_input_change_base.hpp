@@ -51,6 +51,16 @@ public:
         ListenerAction::copy(object);
     }
 
+    void assign(const ListenerInputChangeBase& object)
+    {
+        if (m_InputId != object.m_InputId)
+        {
+            m_InputId = object.m_InputId;
+            inputIdChanged();
+        }
+        ListenerAction::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
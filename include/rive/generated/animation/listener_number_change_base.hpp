@@ -47,12 +47,25 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const ListenerNumberChangeBase& object)
     {
         m_Value = object.m_Value;
         ListenerInputChange::copy(object);
     }
 
+    void assign(const ListenerNumberChangeBase& object)
+    {
+        if (m_Value != object.m_Value)
+        {
+            m_Value = object.m_Value;
+            valueChanged();
+        }
+        ListenerInputChange::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
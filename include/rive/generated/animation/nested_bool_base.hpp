@@ -47,12 +47,25 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const NestedBoolBase& object)
     {
         m_NestedValue = object.m_NestedValue;
         NestedInput::copy(object);
     }
 
+    void assign(const NestedBoolBase& object)
+    {
+        if (m_NestedValue != object.m_NestedValue)
+        {
+            m_NestedValue = object.m_NestedValue;
+            nestedValueChanged();
+        }
+        NestedInput::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -51,6 +51,16 @@ public:
         Component::copy(object);
     }
 
+    void assign(const NestedInputBase& object)
+    {
+        if (m_InputId != object.m_InputId)
+        {
+            m_InputId = object.m_InputId;
+            inputIdChanged();
+        }
+        Component::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
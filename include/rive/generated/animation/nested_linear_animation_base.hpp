@@ -53,6 +53,16 @@ public:
         NestedAnimation::copy(object);
     }
 
+    void assign(const NestedLinearAnimationBase& object)
+    {
+        if (m_Mix != object.m_Mix)
+        {
+            m_Mix = object.m_Mix;
+            mixChanged();
+        }
+        NestedAnimation::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
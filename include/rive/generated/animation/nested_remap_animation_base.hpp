@@ -49,12 +49,25 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const NestedRemapAnimationBase& object)
     {
         m_Time = object.m_Time;
         NestedLinearAnimation::copy(object);
     }
 
+    void assign(const NestedRemapAnimationBase& object)
+    {
+        if (m_Time != object.m_Time)
+        {
+            m_Time = object.m_Time;
+            timeChanged();
+        }
+        NestedLinearAnimation::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -63,6 +63,9 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const NestedSimpleAnimationBase& object)
     {
         m_Speed = object.m_Speed;
@@ -70,6 +73,21 @@ public:
         NestedLinearAnimation::copy(object);
     }
 
+    void assign(const NestedSimpleAnimationBase& object)
+    {
+        if (m_Speed != object.m_Speed)
+        {
+            m_Speed = object.m_Speed;
+            speedChanged();
+        }
+        if (m_IsPlaying != object.m_IsPlaying)
+        {
+            m_IsPlaying = object.m_IsPlaying;
+            isPlayingChanged();
+        }
+        NestedLinearAnimation::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
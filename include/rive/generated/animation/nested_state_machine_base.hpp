@@ -30,6 +30,9 @@ public:
     uint16_t coreType() const override { return typeKey; }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
 
 protected:
 };
@@ -28,6 +28,8 @@ public:
 
     void copy(const StateMachineLayerComponentBase& object) {}
 
+    void assign(const StateMachineLayerComponentBase& object) {}
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override { return false; }
 
 protected:
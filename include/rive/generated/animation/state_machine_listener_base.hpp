@@ -59,6 +59,9 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const StateMachineListenerBase& object)
     {
         m_TargetId = object.m_TargetId;
@@ -66,6 +69,21 @@ public:
         StateMachineComponent::copy(object);
     }
 
+    void assign(const StateMachineListenerBase& object)
+    {
+        if (m_TargetId != object.m_TargetId)
+        {
+            m_TargetId = object.m_TargetId;
+            targetIdChanged();
+        }
+        if (m_ListenerTypeValue != object.m_ListenerTypeValue)
+        {
+            m_ListenerTypeValue = object.m_ListenerTypeValue;
+            listenerTypeValueChanged();
+        }
+        StateMachineComponent::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
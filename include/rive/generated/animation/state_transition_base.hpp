@@ -85,6 +85,9 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const StateTransitionBase& object)
     {
         m_StateToId = object.m_StateToId;
@@ -94,6 +97,31 @@ public:
         StateMachineLayerComponent::copy(object);
     }
 
+    void assign(const StateTransitionBase& object)
+    {
+        if (m_StateToId != object.m_StateToId)
+        {
+            m_StateToId = object.m_StateToId;
+            stateToIdChanged();
+        }
+        if (m_Flags != object.m_Flags)
+        {
+            m_Flags = object.m_Flags;
+            flagsChanged();
+        }
+        if (m_Duration != object.m_Duration)
+        {
+            m_Duration = object.m_Duration;
+            durationChanged();
+        }
+        if (m_ExitTime != object.m_ExitTime)
+        {
+            m_ExitTime = object.m_ExitTime;
+            exitTimeChanged();
+        }
+        StateMachineLayerComponent::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -46,6 +46,15 @@ public:
 
     void copy(const TransitionConditionBase& object) { m_InputId = object.m_InputId; }
 
+    void assign(const TransitionConditionBase& object)
+    {
+        if (m_InputId != object.m_InputId)
+        {
+            m_InputId = object.m_InputId;
+            inputIdChanged();
+        }
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -51,6 +51,16 @@ public:
         TransitionCondition::copy(object);
     }
 
+    void assign(const TransitionValueConditionBase& object)
+    {
+        if (m_OpValue != object.m_OpValue)
+        {
+            m_OpValue = object.m_OpValue;
+            opValueChanged();
+        }
+        TransitionCondition::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -141,6 +141,9 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const ArtboardBase& object)
     {
         m_Clip = object.m_Clip;
@@ -154,6 +157,51 @@ public:
         WorldTransformComponent::copy(object);
     }
 
+    void assign(const ArtboardBase& object)
+    {
+        if (m_Clip != object.m_Clip)
+        {
+            m_Clip = object.m_Clip;
+            clipChanged();
+        }
+        if (m_Width != object.m_Width)
+        {
+            m_Width = object.m_Width;
+            widthChanged();
+        }
+        if (m_Height != object.m_Height)
+        {
+            m_Height = object.m_Height;
+            heightChanged();
+        }
+        if (m_X != object.m_X)
+        {
+            m_X = object.m_X;
+            xChanged();
+        }
+        if (m_Y != object.m_Y)
+        {
+            m_Y = object.m_Y;
+            yChanged();
+        }
+        if (m_OriginX != object.m_OriginX)
+        {
+            m_OriginX = object.m_OriginX;
+            originXChanged();
+        }
+        if (m_OriginY != object.m_OriginY)
+        {
+            m_OriginY = object.m_OriginY;
+            originYChanged();
+        }
+        if (m_DefaultStateMachineId != object.m_DefaultStateMachineId)
+        {
+            m_DefaultStateMachineId = object.m_DefaultStateMachineId;
+            defaultStateMachineIdChanged();
+        }
+        WorldTransformComponent::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -1,8 +1,8 @@
 #ifndef _RIVE_ASSET_BASE_HPP_
 #define _RIVE_ASSET_BASE_HPP_
-#include <string>
 #include "rive/core.hpp"
 #include "rive/core/field_types/core_string_type.hpp"
+#include "rive/shared_string.hpp"
 namespace rive
 {
 class AssetBase : public Core
@@ -31,7 +31,7 @@ public:
     static const uint16_t namePropertyKey = 203;
 
 private:
-    std::string m_Name = "";
+    SharedString m_Name = "";
 
 public:
     inline const std::string& name() const { return m_Name; }
@@ -47,6 +47,15 @@ public:
 
     void copy(const AssetBase& object) { m_Name = object.m_Name; }
 
+    void assign(const AssetBase& object)
+    {
+        if (m_Name != object.m_Name)
+        {
+            m_Name = object.m_Name;
+            nameChanged();
+        }
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -66,6 +66,21 @@ public:
         FileAsset::copy(object);
     }
 
+    void assign(const DrawableAssetBase& object)
+    {
+        if (m_Height != object.m_Height)
+        {
+            m_Height = object.m_Height;
+            heightChanged();
+        }
+        if (m_Width != object.m_Width)
+        {
+            m_Width = object.m_Width;
+            widthChanged();
+        }
+        FileAsset::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -51,6 +51,16 @@ public:
         Asset::copy(object);
     }
 
+    void assign(const FileAssetBase& object)
+    {
+        if (m_AssetId != object.m_AssetId)
+        {
+            m_AssetId = object.m_AssetId;
+            assetIdChanged();
+        }
+        Asset::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
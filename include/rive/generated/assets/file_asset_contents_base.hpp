@@ -35,8 +35,13 @@ public:
     virtual void copyBytes(const FileAssetContentsBase& object) = 0;
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const FileAssetContentsBase& object) { copyBytes(object); }
 
+    void assign(const FileAssetContentsBase& object) {}
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
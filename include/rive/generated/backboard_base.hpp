@@ -27,8 +27,13 @@ public:
     uint16_t coreType() const override { return typeKey; }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const BackboardBase& object) {}
 
+    void assign(const BackboardBase& object) {}
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override { return false; }
 
 protected:
@@ -50,12 +50,25 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const BoneBase& object)
     {
         m_Length = object.m_Length;
         SkeletalComponent::copy(object);
     }
 
+    void assign(const BoneBase& object)
+    {
+        if (m_Length != object.m_Length)
+        {
+            m_Length = object.m_Length;
+            lengthChanged();
+        }
+        SkeletalComponent::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
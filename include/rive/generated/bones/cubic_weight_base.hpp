@@ -86,6 +86,9 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const CubicWeightBase& object)
     {
         m_InValues = object.m_InValues;
@@ -95,6 +98,31 @@ public:
         Weight::copy(object);
     }
 
+    void assign(const CubicWeightBase& object)
+    {
+        if (m_InValues != object.m_InValues)
+        {
+            m_InValues = object.m_InValues;
+            inValuesChanged();
+        }
+        if (m_InIndices != object.m_InIndices)
+        {
+            m_InIndices = object.m_InIndices;
+            inIndicesChanged();
+        }
+        if (m_OutValues != object.m_OutValues)
+        {
+            m_OutValues = object.m_OutValues;
+            outValuesChanged();
+        }
+        if (m_OutIndices != object.m_OutIndices)
+        {
+            m_OutIndices = object.m_OutIndices;
+            outIndicesChanged();
+        }
+        Weight::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
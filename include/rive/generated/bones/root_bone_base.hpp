@@ -64,6 +64,9 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const RootBoneBase& object)
     {
         m_X = object.m_X;
@@ -71,6 +74,21 @@ public:
         Bone::copy(object);
     }
 
+    void assign(const RootBoneBase& object)
+    {
+        if (m_X != object.m_X)
+        {
+            m_X = object.m_X;
+            xChanged();
+        }
+        if (m_Y != object.m_Y)
+        {
+            m_Y = object.m_Y;
+            yChanged();
+        }
+        Bone::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
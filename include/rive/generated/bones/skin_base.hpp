@@ -112,6 +112,9 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const SkinBase& object)
     {
         m_Xx = object.m_Xx;
@@ -123,6 +126,41 @@ public:
         ContainerComponent::copy(object);
     }
 
+    void assign(const SkinBase& object)
+    {
+        if (m_Xx != object.m_Xx)
+        {
+            m_Xx = object.m_Xx;
+            xxChanged();
+        }
+        if (m_Yx != object.m_Yx)
+        {
+            m_Yx = object.m_Yx;
+            yxChanged();
+        }
+        if (m_Xy != object.m_Xy)
+        {
+            m_Xy = object.m_Xy;
+            xyChanged();
+        }
+        if (m_Yy != object.m_Yy)
+        {
+            m_Yy = object.m_Yy;
+            yyChanged();
+        }
+        if (m_Tx != object.m_Tx)
+        {
+            m_Tx = object.m_Tx;
+            txChanged();
+        }
+        if (m_Ty != object.m_Ty)
+        {
+            m_Ty = object.m_Ty;
+            tyChanged();
+        }
+        ContainerComponent::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
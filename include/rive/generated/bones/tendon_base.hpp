@@ -125,6 +125,9 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const TendonBase& object)
     {
         m_BoneId = object.m_BoneId;
@@ -137,6 +140,46 @@ public:
         Component::copy(object);
     }
 
+    void assign(const TendonBase& object)
+    {
+        if (m_BoneId != object.m_BoneId)
+        {
+            m_BoneId = object.m_BoneId;
+            boneIdChanged();
+        }
+        if (m_Xx != object.m_Xx)
+        {
+            m_Xx = object.m_Xx;
+            xxChanged();
+        }
+        if (m_Yx != object.m_Yx)
+        {
+            m_Yx = object.m_Yx;
+            yxChanged();
+        }
+        if (m_Xy != object.m_Xy)
+        {
+            m_Xy = object.m_Xy;
+            xyChanged();
+        }
+        if (m_Yy != object.m_Yy)
+        {
+            m_Yy = object.m_Yy;
+            yyChanged();
+        }
+        if (m_Tx != object.m_Tx)
+        {
+            m_Tx = object.m_Tx;
+            txChanged();
+        }
+        if (m_Ty != object.m_Ty)
+        {
+            m_Ty = object.m_Ty;
+            tyChanged();
+        }
+        Component::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
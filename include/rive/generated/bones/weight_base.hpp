@@ -59,6 +59,9 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const WeightBase& object)
     {
         m_Values = object.m_Values;
@@ -66,6 +69,21 @@ public:
         Component::copy(object);
     }
 
+    void assign(const WeightBase& object)
+    {
+        if (m_Values != object.m_Values)
+        {
+            m_Values = object.m_Values;
+            valuesChanged();
+        }
+        if (m_Indices != object.m_Indices)
+        {
+            m_Indices = object.m_Indices;
+            indicesChanged();
+        }
+        Component::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
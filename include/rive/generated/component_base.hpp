@@ -1,9 +1,9 @@
 #ifndef _RIVE_COMPONENT_BASE_HPP_
 #define _RIVE_COMPONENT_BASE_HPP_
-#include <string>
 #include "rive/core.hpp"
 #include "rive/core/field_types/core_string_type.hpp"
 #include "rive/core/field_types/core_uint_type.hpp"
+#include "rive/shared_string.hpp"
 namespace rive
 {
 class ComponentBase : public Core
@@ -33,7 +33,7 @@ public:
     static const uint16_t parentIdPropertyKey = 5;
 
 private:
-    std::string m_Name = "";
+    SharedString m_Name = "";
     uint32_t m_ParentId = 0;
 
 public:
@@ -65,6 +65,20 @@ public:
         m_ParentId = object.m_ParentId;
     }
 
+    void assign(const ComponentBase& object)
+    {
+        if (m_Name != object.m_Name)
+        {
+            m_Name = object.m_Name;
+            nameChanged();
+        }
+        if (m_ParentId != object.m_ParentId)
+        {
+            m_ParentId = object.m_ParentId;
+            parentIdChanged();
+        }
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -51,6 +51,16 @@ public:
         Component::copy(object);
     }
 
+    void assign(const ConstraintBase& object)
+    {
+        if (m_Strength != object.m_Strength)
+        {
+            m_Strength = object.m_Strength;
+            strengthChanged();
+        }
+        Component::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
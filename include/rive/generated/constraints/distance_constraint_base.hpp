@@ -62,6 +62,9 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const DistanceConstraintBase& object)
     {
         m_Distance = object.m_Distance;
@@ -69,6 +72,21 @@ public:
         TargetedConstraint::copy(object);
     }
 
+    void assign(const DistanceConstraintBase& object)
+    {
+        if (m_Distance != object.m_Distance)
+        {
+            m_Distance = object.m_Distance;
+            distanceChanged();
+        }
+        if (m_ModeValue != object.m_ModeValue)
+        {
+            m_ModeValue = object.m_ModeValue;
+            modeValueChanged();
+        }
+        TargetedConstraint::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -62,6 +62,9 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const IKConstraintBase& object)
     {
         m_InvertDirection = object.m_InvertDirection;
@@ -69,6 +72,21 @@ public:
         TargetedConstraint::copy(object);
     }
 
+    void assign(const IKConstraintBase& object)
+    {
+        if (m_InvertDirection != object.m_InvertDirection)
+        {
+            m_InvertDirection = object.m_InvertDirection;
+            invertDirectionChanged();
+        }
+        if (m_ParentBoneCount != object.m_ParentBoneCount)
+        {
+            m_ParentBoneCount = object.m_ParentBoneCount;
+            parentBoneCountChanged();
+        }
+        TargetedConstraint::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
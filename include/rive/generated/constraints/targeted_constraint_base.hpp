@@ -52,6 +52,16 @@ public:
         Constraint::copy(object);
     }
 
+    void assign(const TargetedConstraintBase& object)
+    {
+        if (m_TargetId != object.m_TargetId)
+        {
+            m_TargetId = object.m_TargetId;
+            targetIdChanged();
+        }
+        Constraint::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
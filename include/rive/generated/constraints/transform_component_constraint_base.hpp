@@ -154,6 +154,51 @@ public:
         TransformSpaceConstraint::copy(object);
     }
 
+    void assign(const TransformComponentConstraintBase& object)
+    {
+        if (m_MinMaxSpaceValue != object.m_MinMaxSpaceValue)
+        {
+            m_MinMaxSpaceValue = object.m_MinMaxSpaceValue;
+            minMaxSpaceValueChanged();
+        }
+        if (m_CopyFactor != object.m_CopyFactor)
+        {
+            m_CopyFactor = object.m_CopyFactor;
+            copyFactorChanged();
+        }
+        if (m_MinValue != object.m_MinValue)
+        {
+            m_MinValue = object.m_MinValue;
+            minValueChanged();
+        }
+        if (m_MaxValue != object.m_MaxValue)
+        {
+            m_MaxValue = object.m_MaxValue;
+            maxValueChanged();
+        }
+        if (m_Offset != object.m_Offset)
+        {
+            m_Offset = object.m_Offset;
+            offsetChanged();
+        }
+        if (m_DoesCopy != object.m_DoesCopy)
+        {
+            m_DoesCopy = object.m_DoesCopy;
+            doesCopyChanged();
+        }
+        if (m_Min != object.m_Min)
+        {
+            m_Min = object.m_Min;
+            minChanged();
+        }
+        if (m_Max != object.m_Max)
+        {
+            m_Max = object.m_Max;
+            maxChanged();
+        }
+        TransformSpaceConstraint::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -126,6 +126,41 @@ public:
         TransformComponentConstraint::copy(object);
     }
 
+    void assign(const TransformComponentConstraintYBase& object)
+    {
+        if (m_CopyFactorY != object.m_CopyFactorY)
+        {
+            m_CopyFactorY = object.m_CopyFactorY;
+            copyFactorYChanged();
+        }
+        if (m_MinValueY != object.m_MinValueY)
+        {
+            m_MinValueY = object.m_MinValueY;
+            minValueYChanged();
+        }
+        if (m_MaxValueY != object.m_MaxValueY)
+        {
+            m_MaxValueY = object.m_MaxValueY;
+            maxValueYChanged();
+        }
+        if (m_DoesCopyY != object.m_DoesCopyY)
+        {
+            m_DoesCopyY = object.m_DoesCopyY;
+            doesCopyYChanged();
+        }
+        if (m_MinY != object.m_MinY)
+        {
+            m_MinY = object.m_MinY;
+            minYChanged();
+        }
+        if (m_MaxY != object.m_MaxY)
+        {
+            m_MaxY = object.m_MaxY;
+            maxYChanged();
+        }
+        TransformComponentConstraint::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -67,6 +67,21 @@ public:
         TargetedConstraint::copy(object);
     }
 
+    void assign(const TransformSpaceConstraintBase& object)
+    {
+        if (m_SourceSpaceValue != object.m_SourceSpaceValue)
+        {
+            m_SourceSpaceValue = object.m_SourceSpaceValue;
+            sourceSpaceValueChanged();
+        }
+        if (m_DestSpaceValue != object.m_DestSpaceValue)
+        {
+            m_DestSpaceValue = object.m_DestSpaceValue;
+            destSpaceValueChanged();
+        }
+        TargetedConstraint::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
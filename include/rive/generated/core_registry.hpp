@@ -1212,192 +1212,1382 @@ public:
         }
         return 0;
     }
-    static int propertyFieldId(int propertyKey)
+    static CoreStringType::Setter stringSetter(int propertyKey)
+    {
+        switch (propertyKey)
+        {
+            case ComponentBase::namePropertyKey:
+                return [](Core* object, std::string value) {
+                    object->as<ComponentBase>()->name(value);
+                };
+            case StateMachineComponentBase::namePropertyKey:
+                return [](Core* object, std::string value) {
+                    object->as<StateMachineComponentBase>()->name(value);
+                };
+            case AnimationBase::namePropertyKey:
+                return [](Core* object, std::string value) {
+                    object->as<AnimationBase>()->name(value);
+                };
+            case AssetBase::namePropertyKey:
+                return [](Core* object, std::string value) {
+                    object->as<AssetBase>()->name(value);
+                };
+        }
+        return nullptr;
+    }
+    static CoreUintType::Setter uintSetter(int propertyKey)
+    {
+        switch (propertyKey)
+        {
+            case ComponentBase::parentIdPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<ComponentBase>()->parentId(value);
+                };
+            case DrawTargetBase::drawableIdPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<DrawTargetBase>()->drawableId(value);
+                };
+            case DrawTargetBase::placementValuePropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<DrawTargetBase>()->placementValue(value);
+                };
+            case TargetedConstraintBase::targetIdPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<TargetedConstraintBase>()->targetId(value);
+                };
+            case DistanceConstraintBase::modeValuePropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<DistanceConstraintBase>()->modeValue(value);
+                };
+            case TransformSpaceConstraintBase::sourceSpaceValuePropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<TransformSpaceConstraintBase>()->sourceSpaceValue(value);
+                };
+            case TransformSpaceConstraintBase::destSpaceValuePropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<TransformSpaceConstraintBase>()->destSpaceValue(value);
+                };
+            case TransformComponentConstraintBase::minMaxSpaceValuePropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<TransformComponentConstraintBase>()->minMaxSpaceValue(value);
+                };
+            case IKConstraintBase::parentBoneCountPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<IKConstraintBase>()->parentBoneCount(value);
+                };
+            case DrawableBase::blendModeValuePropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<DrawableBase>()->blendModeValue(value);
+                };
+            case DrawableBase::drawableFlagsPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<DrawableBase>()->drawableFlags(value);
+                };
+            case NestedArtboardBase::artboardIdPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<NestedArtboardBase>()->artboardId(value);
+                };
+            case NestedAnimationBase::animationIdPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<NestedAnimationBase>()->animationId(value);
+                };
+            case ListenerInputChangeBase::inputIdPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<ListenerInputChangeBase>()->inputId(value);
+                };
+            case AnimationStateBase::animationIdPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<AnimationStateBase>()->animationId(value);
+                };
+            case NestedInputBase::inputIdPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<NestedInputBase>()->inputId(value);
+                };
+            case KeyedObjectBase::objectIdPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<KeyedObjectBase>()->objectId(value);
+                };
+            case BlendAnimationBase::animationIdPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<BlendAnimationBase>()->animationId(value);
+                };
+            case BlendAnimationDirectBase::inputIdPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<BlendAnimationDirectBase>()->inputId(value);
+                };
+            case TransitionConditionBase::inputIdPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<TransitionConditionBase>()->inputId(value);
+                };
+            case KeyedPropertyBase::propertyKeyPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<KeyedPropertyBase>()->propertyKey(value);
+                };
+            case StateMachineListenerBase::targetIdPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<StateMachineListenerBase>()->targetId(value);
+                };
+            case StateMachineListenerBase::listenerTypeValuePropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<StateMachineListenerBase>()->listenerTypeValue(value);
+                };
+            case KeyFrameBase::framePropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<KeyFrameBase>()->frame(value);
+                };
+            case KeyFrameBase::interpolationTypePropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<KeyFrameBase>()->interpolationType(value);
+                };
+            case KeyFrameBase::interpolatorIdPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<KeyFrameBase>()->interpolatorId(value);
+                };
+            case KeyFrameIdBase::valuePropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<KeyFrameIdBase>()->value(value);
+                };
+            case ListenerBoolChangeBase::valuePropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<ListenerBoolChangeBase>()->value(value);
+                };
+            case ListenerAlignTargetBase::targetIdPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<ListenerAlignTargetBase>()->targetId(value);
+                };
+            case TransitionValueConditionBase::opValuePropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<TransitionValueConditionBase>()->opValue(value);
+                };
+            case StateTransitionBase::stateToIdPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<StateTransitionBase>()->stateToId(value);
+                };
+            case StateTransitionBase::flagsPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<StateTransitionBase>()->flags(value);
+                };
+            case StateTransitionBase::durationPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<StateTransitionBase>()->duration(value);
+                };
+            case StateTransitionBase::exitTimePropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<StateTransitionBase>()->exitTime(value);
+                };
+            case LinearAnimationBase::fpsPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<LinearAnimationBase>()->fps(value);
+                };
+            case LinearAnimationBase::durationPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<LinearAnimationBase>()->duration(value);
+                };
+            case LinearAnimationBase::loopValuePropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<LinearAnimationBase>()->loopValue(value);
+                };
+            case LinearAnimationBase::workStartPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<LinearAnimationBase>()->workStart(value);
+                };
+            case LinearAnimationBase::workEndPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<LinearAnimationBase>()->workEnd(value);
+                };
+            case BlendState1DBase::inputIdPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<BlendState1DBase>()->inputId(value);
+                };
+            case BlendStateTransitionBase::exitBlendAnimationIdPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<BlendStateTransitionBase>()->exitBlendAnimationId(value);
+                };
+            case StrokeBase::capPropertyKey:
+                return [](Core* object, uint32_t value) { object->as<StrokeBase>()->cap(value); };
+            case StrokeBase::joinPropertyKey:
+                return [](Core* object, uint32_t value) { object->as<StrokeBase>()->join(value); };
+            case TrimPathBase::modeValuePropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<TrimPathBase>()->modeValue(value);
+                };
+            case FillBase::fillRulePropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<FillBase>()->fillRule(value);
+                };
+            case PathBase::pathFlagsPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<PathBase>()->pathFlags(value);
+                };
+            case ClippingShapeBase::sourceIdPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<ClippingShapeBase>()->sourceId(value);
+                };
+            case ClippingShapeBase::fillRulePropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<ClippingShapeBase>()->fillRule(value);
+                };
+            case PolygonBase::pointsPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<PolygonBase>()->points(value);
+                };
+            case ImageBase::assetIdPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<ImageBase>()->assetId(value);
+                };
+            case DrawRulesBase::drawTargetIdPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<DrawRulesBase>()->drawTargetId(value);
+                };
+            case ArtboardBase::defaultStateMachineIdPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<ArtboardBase>()->defaultStateMachineId(value);
+                };
+            case WeightBase::valuesPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<WeightBase>()->values(value);
+                };
+            case WeightBase::indicesPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<WeightBase>()->indices(value);
+                };
+            case TendonBase::boneIdPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<TendonBase>()->boneId(value);
+                };
+            case CubicWeightBase::inValuesPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<CubicWeightBase>()->inValues(value);
+                };
+            case CubicWeightBase::inIndicesPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<CubicWeightBase>()->inIndices(value);
+                };
+            case CubicWeightBase::outValuesPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<CubicWeightBase>()->outValues(value);
+                };
+            case CubicWeightBase::outIndicesPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<CubicWeightBase>()->outIndices(value);
+                };
+            case FileAssetBase::assetIdPropertyKey:
+                return [](Core* object, uint32_t value) {
+                    object->as<FileAssetBase>()->assetId(value);
+                };
+        }
+        return nullptr;
+    }
+    static CoreDoubleType::Setter doubleSetter(int propertyKey)
+    {
+        switch (propertyKey)
+        {
+            case ConstraintBase::strengthPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<ConstraintBase>()->strength(value);
+                };
+            case DistanceConstraintBase::distancePropertyKey:
+                return [](Core* object, float value) {
+                    object->as<DistanceConstraintBase>()->distance(value);
+                };
+            case TransformComponentConstraintBase::copyFactorPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<TransformComponentConstraintBase>()->copyFactor(value);
+                };
+            case TransformComponentConstraintBase::minValuePropertyKey:
+                return [](Core* object, float value) {
+                    object->as<TransformComponentConstraintBase>()->minValue(value);
+                };
+            case TransformComponentConstraintBase::maxValuePropertyKey:
+                return [](Core* object, float value) {
+                    object->as<TransformComponentConstraintBase>()->maxValue(value);
+                };
+            case TransformComponentConstraintYBase::copyFactorYPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<TransformComponentConstraintYBase>()->copyFactorY(value);
+                };
+            case TransformComponentConstraintYBase::minValueYPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<TransformComponentConstraintYBase>()->minValueY(value);
+                };
+            case TransformComponentConstraintYBase::maxValueYPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<TransformComponentConstraintYBase>()->maxValueY(value);
+                };
+            case WorldTransformComponentBase::opacityPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<WorldTransformComponentBase>()->opacity(value);
+                };
+            case TransformComponentBase::rotationPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<TransformComponentBase>()->rotation(value);
+                };
+            case TransformComponentBase::scaleXPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<TransformComponentBase>()->scaleX(value);
+                };
+            case TransformComponentBase::scaleYPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<TransformComponentBase>()->scaleY(value);
+                };
+            case NodeBase::xPropertyKey:
+                return [](Core* object, float value) { object->as<NodeBase>()->x(value); };
+            case NodeBase::yPropertyKey:
+                return [](Core* object, float value) { object->as<NodeBase>()->y(value); };
+            case NestedLinearAnimationBase::mixPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<NestedLinearAnimationBase>()->mix(value);
+                };
+            case NestedSimpleAnimationBase::speedPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<NestedSimpleAnimationBase>()->speed(value);
+                };
+            case StateMachineNumberBase::valuePropertyKey:
+                return [](Core* object, float value) {
+                    object->as<StateMachineNumberBase>()->value(value);
+                };
+            case TransitionNumberConditionBase::valuePropertyKey:
+                return [](Core* object, float value) {
+                    object->as<TransitionNumberConditionBase>()->value(value);
+                };
+            case ListenerNumberChangeBase::valuePropertyKey:
+                return [](Core* object, float value) {
+                    object->as<ListenerNumberChangeBase>()->value(value);
+                };
+            case CubicInterpolatorBase::x1PropertyKey:
+                return [](Core* object, float value) {
+                    object->as<CubicInterpolatorBase>()->x1(value);
+                };
+            case CubicInterpolatorBase::y1PropertyKey:
+                return [](Core* object, float value) {
+                    object->as<CubicInterpolatorBase>()->y1(value);
+                };
+            case CubicInterpolatorBase::x2PropertyKey:
+                return [](Core* object, float value) {
+                    object->as<CubicInterpolatorBase>()->x2(value);
+                };
+            case CubicInterpolatorBase::y2PropertyKey:
+                return [](Core* object, float value) {
+                    object->as<CubicInterpolatorBase>()->y2(value);
+                };
+            case KeyFrameDoubleBase::valuePropertyKey:
+                return [](Core* object, float value) {
+                    object->as<KeyFrameDoubleBase>()->value(value);
+                };
+            case LinearAnimationBase::speedPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<LinearAnimationBase>()->speed(value);
+                };
+            case NestedNumberBase::nestedValuePropertyKey:
+                return [](Core* object, float value) {
+                    object->as<NestedNumberBase>()->nestedValue(value);
+                };
+            case NestedRemapAnimationBase::timePropertyKey:
+                return [](Core* object, float value) {
+                    object->as<NestedRemapAnimationBase>()->time(value);
+                };
+            case BlendAnimation1DBase::valuePropertyKey:
+                return [](Core* object, float value) {
+                    object->as<BlendAnimation1DBase>()->value(value);
+                };
+            case LinearGradientBase::startXPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<LinearGradientBase>()->startX(value);
+                };
+            case LinearGradientBase::startYPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<LinearGradientBase>()->startY(value);
+                };
+            case LinearGradientBase::endXPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<LinearGradientBase>()->endX(value);
+                };
+            case LinearGradientBase::endYPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<LinearGradientBase>()->endY(value);
+                };
+            case LinearGradientBase::opacityPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<LinearGradientBase>()->opacity(value);
+                };
+            case StrokeBase::thicknessPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<StrokeBase>()->thickness(value);
+                };
+            case GradientStopBase::positionPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<GradientStopBase>()->position(value);
+                };
+            case TrimPathBase::startPropertyKey:
+                return [](Core* object, float value) { object->as<TrimPathBase>()->start(value); };
+            case TrimPathBase::endPropertyKey:
+                return [](Core* object, float value) { object->as<TrimPathBase>()->end(value); };
+            case TrimPathBase::offsetPropertyKey:
+                return [](Core* object, float value) { object->as<TrimPathBase>()->offset(value); };
+            case VertexBase::xPropertyKey:
+                return [](Core* object, float value) { object->as<VertexBase>()->x(value); };
+            case VertexBase::yPropertyKey:
+                return [](Core* object, float value) { object->as<VertexBase>()->y(value); };
+            case MeshVertexBase::uPropertyKey:
+                return [](Core* object, float value) { object->as<MeshVertexBase>()->u(value); };
+            case MeshVertexBase::vPropertyKey:
+                return [](Core* object, float value) { object->as<MeshVertexBase>()->v(value); };
+            case StraightVertexBase::radiusPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<StraightVertexBase>()->radius(value);
+                };
+            case CubicAsymmetricVertexBase::rotationPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<CubicAsymmetricVertexBase>()->rotation(value);
+                };
+            case CubicAsymmetricVertexBase::inDistancePropertyKey:
+                return [](Core* object, float value) {
+                    object->as<CubicAsymmetricVertexBase>()->inDistance(value);
+                };
+            case CubicAsymmetricVertexBase::outDistancePropertyKey:
+                return [](Core* object, float value) {
+                    object->as<CubicAsymmetricVertexBase>()->outDistance(value);
+                };
+            case ParametricPathBase::widthPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<ParametricPathBase>()->width(value);
+                };
+            case ParametricPathBase::heightPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<ParametricPathBase>()->height(value);
+                };
+            case ParametricPathBase::originXPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<ParametricPathBase>()->originX(value);
+                };
+            case ParametricPathBase::originYPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<ParametricPathBase>()->originY(value);
+                };
+            case RectangleBase::cornerRadiusTLPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<RectangleBase>()->cornerRadiusTL(value);
+                };
+            case RectangleBase::cornerRadiusTRPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<RectangleBase>()->cornerRadiusTR(value);
+                };
+            case RectangleBase::cornerRadiusBLPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<RectangleBase>()->cornerRadiusBL(value);
+                };
+            case RectangleBase::cornerRadiusBRPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<RectangleBase>()->cornerRadiusBR(value);
+                };
+            case CubicMirroredVertexBase::rotationPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<CubicMirroredVertexBase>()->rotation(value);
+                };
+            case CubicMirroredVertexBase::distancePropertyKey:
+                return [](Core* object, float value) {
+                    object->as<CubicMirroredVertexBase>()->distance(value);
+                };
+            case PolygonBase::cornerRadiusPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<PolygonBase>()->cornerRadius(value);
+                };
+            case StarBase::innerRadiusPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<StarBase>()->innerRadius(value);
+                };
+            case CubicDetachedVertexBase::inRotationPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<CubicDetachedVertexBase>()->inRotation(value);
+                };
+            case CubicDetachedVertexBase::inDistancePropertyKey:
+                return [](Core* object, float value) {
+                    object->as<CubicDetachedVertexBase>()->inDistance(value);
+                };
+            case CubicDetachedVertexBase::outRotationPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<CubicDetachedVertexBase>()->outRotation(value);
+                };
+            case CubicDetachedVertexBase::outDistancePropertyKey:
+                return [](Core* object, float value) {
+                    object->as<CubicDetachedVertexBase>()->outDistance(value);
+                };
+            case ArtboardBase::widthPropertyKey:
+                return [](Core* object, float value) { object->as<ArtboardBase>()->width(value); };
+            case ArtboardBase::heightPropertyKey:
+                return [](Core* object, float value) { object->as<ArtboardBase>()->height(value); };
+            case ArtboardBase::xPropertyKey:
+                return [](Core* object, float value) { object->as<ArtboardBase>()->x(value); };
+            case ArtboardBase::yPropertyKey:
+                return [](Core* object, float value) { object->as<ArtboardBase>()->y(value); };
+            case ArtboardBase::originXPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<ArtboardBase>()->originX(value);
+                };
+            case ArtboardBase::originYPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<ArtboardBase>()->originY(value);
+                };
+            case BoneBase::lengthPropertyKey:
+                return [](Core* object, float value) { object->as<BoneBase>()->length(value); };
+            case RootBoneBase::xPropertyKey:
+                return [](Core* object, float value) { object->as<RootBoneBase>()->x(value); };
+            case RootBoneBase::yPropertyKey:
+                return [](Core* object, float value) { object->as<RootBoneBase>()->y(value); };
+            case SkinBase::xxPropertyKey:
+                return [](Core* object, float value) { object->as<SkinBase>()->xx(value); };
+            case SkinBase::yxPropertyKey:
+                return [](Core* object, float value) { object->as<SkinBase>()->yx(value); };
+            case SkinBase::xyPropertyKey:
+                return [](Core* object, float value) { object->as<SkinBase>()->xy(value); };
+            case SkinBase::yyPropertyKey:
+                return [](Core* object, float value) { object->as<SkinBase>()->yy(value); };
+            case SkinBase::txPropertyKey:
+                return [](Core* object, float value) { object->as<SkinBase>()->tx(value); };
+            case SkinBase::tyPropertyKey:
+                return [](Core* object, float value) { object->as<SkinBase>()->ty(value); };
+            case TendonBase::xxPropertyKey:
+                return [](Core* object, float value) { object->as<TendonBase>()->xx(value); };
+            case TendonBase::yxPropertyKey:
+                return [](Core* object, float value) { object->as<TendonBase>()->yx(value); };
+            case TendonBase::xyPropertyKey:
+                return [](Core* object, float value) { object->as<TendonBase>()->xy(value); };
+            case TendonBase::yyPropertyKey:
+                return [](Core* object, float value) { object->as<TendonBase>()->yy(value); };
+            case TendonBase::txPropertyKey:
+                return [](Core* object, float value) { object->as<TendonBase>()->tx(value); };
+            case TendonBase::tyPropertyKey:
+                return [](Core* object, float value) { object->as<TendonBase>()->ty(value); };
+            case DrawableAssetBase::heightPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<DrawableAssetBase>()->height(value);
+                };
+            case DrawableAssetBase::widthPropertyKey:
+                return [](Core* object, float value) {
+                    object->as<DrawableAssetBase>()->width(value);
+                };
+        }
+        return nullptr;
+    }
+    static CoreBoolType::Setter boolSetter(int propertyKey)
+    {
+        switch (propertyKey)
+        {
+            case TransformComponentConstraintBase::offsetPropertyKey:
+                return [](Core* object, bool value) {
+                    object->as<TransformComponentConstraintBase>()->offset(value);
+                };
+            case TransformComponentConstraintBase::doesCopyPropertyKey:
+                return [](Core* object, bool value) {
+                    object->as<TransformComponentConstraintBase>()->doesCopy(value);
+                };
+            case TransformComponentConstraintBase::minPropertyKey:
+                return [](Core* object, bool value) {
+                    object->as<TransformComponentConstraintBase>()->min(value);
+                };
+            case TransformComponentConstraintBase::maxPropertyKey:
+                return [](Core* object, bool value) {
+                    object->as<TransformComponentConstraintBase>()->max(value);
+                };
+            case TransformComponentConstraintYBase::doesCopyYPropertyKey:
+                return [](Core* object, bool value) {
+                    object->as<TransformComponentConstraintYBase>()->doesCopyY(value);
+                };
+            case TransformComponentConstraintYBase::minYPropertyKey:
+                return [](Core* object, bool value) {
+                    object->as<TransformComponentConstraintYBase>()->minY(value);
+                };
+            case TransformComponentConstraintYBase::maxYPropertyKey:
+                return [](Core* object, bool value) {
+                    object->as<TransformComponentConstraintYBase>()->maxY(value);
+                };
+            case IKConstraintBase::invertDirectionPropertyKey:
+                return [](Core* object, bool value) {
+                    object->as<IKConstraintBase>()->invertDirection(value);
+                };
+            case NestedSimpleAnimationBase::isPlayingPropertyKey:
+                return [](Core* object, bool value) {
+                    object->as<NestedSimpleAnimationBase>()->isPlaying(value);
+                };
+            case KeyFrameBoolBase::valuePropertyKey:
+                return [](Core* object, bool value) {
+                    object->as<KeyFrameBoolBase>()->value(value);
+                };
+            case NestedBoolBase::nestedValuePropertyKey:
+                return [](Core* object, bool value) {
+                    object->as<NestedBoolBase>()->nestedValue(value);
+                };
+            case LinearAnimationBase::enableWorkAreaPropertyKey:
+                return [](Core* object, bool value) {
+                    object->as<LinearAnimationBase>()->enableWorkArea(value);
+                };
+            case StateMachineBoolBase::valuePropertyKey:
+                return [](Core* object, bool value) {
+                    object->as<StateMachineBoolBase>()->value(value);
+                };
+            case ShapePaintBase::isVisiblePropertyKey:
+                return [](Core* object, bool value) {
+                    object->as<ShapePaintBase>()->isVisible(value);
+                };
+            case StrokeBase::transformAffectsStrokePropertyKey:
+                return [](Core* object, bool value) {
+                    object->as<StrokeBase>()->transformAffectsStroke(value);
+                };
+            case PointsPathBase::isClosedPropertyKey:
+                return [](Core* object, bool value) {
+                    object->as<PointsPathBase>()->isClosed(value);
+                };
+            case RectangleBase::linkCornerRadiusPropertyKey:
+                return [](Core* object, bool value) {
+                    object->as<RectangleBase>()->linkCornerRadius(value);
+                };
+            case ClippingShapeBase::isVisiblePropertyKey:
+                return [](Core* object, bool value) {
+                    object->as<ClippingShapeBase>()->isVisible(value);
+                };
+            case ArtboardBase::clipPropertyKey:
+                return [](Core* object, bool value) { object->as<ArtboardBase>()->clip(value); };
+        }
+        return nullptr;
+    }
+    static CoreColorType::Setter colorSetter(int propertyKey)
+    {
+        switch (propertyKey)
+        {
+            case KeyFrameColorBase::valuePropertyKey:
+                return [](Core* object, int value) {
+                    object->as<KeyFrameColorBase>()->value(value);
+                };
+            case SolidColorBase::colorValuePropertyKey:
+                return [](Core* object, int value) {
+                    object->as<SolidColorBase>()->colorValue(value);
+                };
+            case GradientStopBase::colorValuePropertyKey:
+                return [](Core* object, int value) {
+                    object->as<GradientStopBase>()->colorValue(value);
+                };
+        }
+        return nullptr;
+    }
+    static CoreStringType::Getter stringGetter(int propertyKey)
     {
         switch (propertyKey)
         {
             case ComponentBase::namePropertyKey:
+                return [](Core* object) { return object->as<ComponentBase>()->name(); };
             case StateMachineComponentBase::namePropertyKey:
+                return [](Core* object) { return object->as<StateMachineComponentBase>()->name(); };
             case AnimationBase::namePropertyKey:
+                return [](Core* object) { return object->as<AnimationBase>()->name(); };
             case AssetBase::namePropertyKey:
-                return CoreStringType::id;
+                return [](Core* object) { return object->as<AssetBase>()->name(); };
+        }
+        return nullptr;
+    }
+    static CoreUintType::Getter uintGetter(int propertyKey)
+    {
+        switch (propertyKey)
+        {
             case ComponentBase::parentIdPropertyKey:
+                return [](Core* object) { return object->as<ComponentBase>()->parentId(); };
             case DrawTargetBase::drawableIdPropertyKey:
+                return [](Core* object) { return object->as<DrawTargetBase>()->drawableId(); };
             case DrawTargetBase::placementValuePropertyKey:
+                return [](Core* object) { return object->as<DrawTargetBase>()->placementValue(); };
             case TargetedConstraintBase::targetIdPropertyKey:
+                return [](Core* object) {
+                    return object->as<TargetedConstraintBase>()->targetId();
+                };
             case DistanceConstraintBase::modeValuePropertyKey:
+                return [](Core* object) {
+                    return object->as<DistanceConstraintBase>()->modeValue();
+                };
             case TransformSpaceConstraintBase::sourceSpaceValuePropertyKey:
+                return [](Core* object) {
+                    return object->as<TransformSpaceConstraintBase>()->sourceSpaceValue();
+                };
             case TransformSpaceConstraintBase::destSpaceValuePropertyKey:
+                return [](Core* object) {
+                    return object->as<TransformSpaceConstraintBase>()->destSpaceValue();
+                };
             case TransformComponentConstraintBase::minMaxSpaceValuePropertyKey:
+                return [](Core* object) {
+                    return object->as<TransformComponentConstraintBase>()->minMaxSpaceValue();
+                };
             case IKConstraintBase::parentBoneCountPropertyKey:
+                return [](Core* object) {
+                    return object->as<IKConstraintBase>()->parentBoneCount();
+                };
             case DrawableBase::blendModeValuePropertyKey:
+                return [](Core* object) { return object->as<DrawableBase>()->blendModeValue(); };
             case DrawableBase::drawableFlagsPropertyKey:
+                return [](Core* object) { return object->as<DrawableBase>()->drawableFlags(); };
             case NestedArtboardBase::artboardIdPropertyKey:
+                return [](Core* object) { return object->as<NestedArtboardBase>()->artboardId(); };
             case NestedAnimationBase::animationIdPropertyKey:
+                return [](Core* object) {
+                    return object->as<NestedAnimationBase>()->animationId();
+                };
             case ListenerInputChangeBase::inputIdPropertyKey:
+                return [](Core* object) {
+                    return object->as<ListenerInputChangeBase>()->inputId();
+                };
             case AnimationStateBase::animationIdPropertyKey:
+                return [](Core* object) { return object->as<AnimationStateBase>()->animationId(); };
             case NestedInputBase::inputIdPropertyKey:
+                return [](Core* object) { return object->as<NestedInputBase>()->inputId(); };
             case KeyedObjectBase::objectIdPropertyKey:
+                return [](Core* object) { return object->as<KeyedObjectBase>()->objectId(); };
             case BlendAnimationBase::animationIdPropertyKey:
+                return [](Core* object) { return object->as<BlendAnimationBase>()->animationId(); };
             case BlendAnimationDirectBase::inputIdPropertyKey:
+                return [](Core* object) {
+                    return object->as<BlendAnimationDirectBase>()->inputId();
+                };
             case TransitionConditionBase::inputIdPropertyKey:
+                return [](Core* object) {
+                    return object->as<TransitionConditionBase>()->inputId();
+                };
             case KeyedPropertyBase::propertyKeyPropertyKey:
+                return [](Core* object) { return object->as<KeyedPropertyBase>()->propertyKey(); };
             case StateMachineListenerBase::targetIdPropertyKey:
+                return [](Core* object) {
+                    return object->as<StateMachineListenerBase>()->targetId();
+                };
             case StateMachineListenerBase::listenerTypeValuePropertyKey:
+                return [](Core* object) {
+                    return object->as<StateMachineListenerBase>()->listenerTypeValue();
+                };
             case KeyFrameBase::framePropertyKey:
+                return [](Core* object) { return object->as<KeyFrameBase>()->frame(); };
             case KeyFrameBase::interpolationTypePropertyKey:
+                return [](Core* object) { return object->as<KeyFrameBase>()->interpolationType(); };
             case KeyFrameBase::interpolatorIdPropertyKey:
+                return [](Core* object) { return object->as<KeyFrameBase>()->interpolatorId(); };
             case KeyFrameIdBase::valuePropertyKey:
+                return [](Core* object) { return object->as<KeyFrameIdBase>()->value(); };
             case ListenerBoolChangeBase::valuePropertyKey:
+                return [](Core* object) { return object->as<ListenerBoolChangeBase>()->value(); };
             case ListenerAlignTargetBase::targetIdPropertyKey:
+                return [](Core* object) {
+                    return object->as<ListenerAlignTargetBase>()->targetId();
+                };
             case TransitionValueConditionBase::opValuePropertyKey:
+                return [](Core* object) {
+                    return object->as<TransitionValueConditionBase>()->opValue();
+                };
             case StateTransitionBase::stateToIdPropertyKey:
+                return [](Core* object) { return object->as<StateTransitionBase>()->stateToId(); };
             case StateTransitionBase::flagsPropertyKey:
+                return [](Core* object) { return object->as<StateTransitionBase>()->flags(); };
             case StateTransitionBase::durationPropertyKey:
+                return [](Core* object) { return object->as<StateTransitionBase>()->duration(); };
             case StateTransitionBase::exitTimePropertyKey:
+                return [](Core* object) { return object->as<StateTransitionBase>()->exitTime(); };
             case LinearAnimationBase::fpsPropertyKey:
+                return [](Core* object) { return object->as<LinearAnimationBase>()->fps(); };
             case LinearAnimationBase::durationPropertyKey:
+                return [](Core* object) { return object->as<LinearAnimationBase>()->duration(); };
             case LinearAnimationBase::loopValuePropertyKey:
+                return [](Core* object) { return object->as<LinearAnimationBase>()->loopValue(); };
             case LinearAnimationBase::workStartPropertyKey:
+                return [](Core* object) { return object->as<LinearAnimationBase>()->workStart(); };
             case LinearAnimationBase::workEndPropertyKey:
+                return [](Core* object) { return object->as<LinearAnimationBase>()->workEnd(); };
             case BlendState1DBase::inputIdPropertyKey:
+                return [](Core* object) { return object->as<BlendState1DBase>()->inputId(); };
             case BlendStateTransitionBase::exitBlendAnimationIdPropertyKey:
+                return [](Core* object) {
+                    return object->as<BlendStateTransitionBase>()->exitBlendAnimationId();
+                };
             case StrokeBase::capPropertyKey:
+                return [](Core* object) { return object->as<StrokeBase>()->cap(); };
             case StrokeBase::joinPropertyKey:
+                return [](Core* object) { return object->as<StrokeBase>()->join(); };
             case TrimPathBase::modeValuePropertyKey:
+                return [](Core* object) { return object->as<TrimPathBase>()->modeValue(); };
             case FillBase::fillRulePropertyKey:
+                return [](Core* object) { return object->as<FillBase>()->fillRule(); };
             case PathBase::pathFlagsPropertyKey:
+                return [](Core* object) { return object->as<PathBase>()->pathFlags(); };
             case ClippingShapeBase::sourceIdPropertyKey:
+                return [](Core* object) { return object->as<ClippingShapeBase>()->sourceId(); };
             case ClippingShapeBase::fillRulePropertyKey:
+                return [](Core* object) { return object->as<ClippingShapeBase>()->fillRule(); };
             case PolygonBase::pointsPropertyKey:
+                return [](Core* object) { return object->as<PolygonBase>()->points(); };
             case ImageBase::assetIdPropertyKey:
+                return [](Core* object) { return object->as<ImageBase>()->assetId(); };
             case DrawRulesBase::drawTargetIdPropertyKey:
+                return [](Core* object) { return object->as<DrawRulesBase>()->drawTargetId(); };
             case ArtboardBase::defaultStateMachineIdPropertyKey:
+                return [](Core* object) {
+                    return object->as<ArtboardBase>()->defaultStateMachineId();
+                };
             case WeightBase::valuesPropertyKey:
+                return [](Core* object) { return object->as<WeightBase>()->values(); };
             case WeightBase::indicesPropertyKey:
+                return [](Core* object) { return object->as<WeightBase>()->indices(); };
             case TendonBase::boneIdPropertyKey:
+                return [](Core* object) { return object->as<TendonBase>()->boneId(); };
             case CubicWeightBase::inValuesPropertyKey:
+                return [](Core* object) { return object->as<CubicWeightBase>()->inValues(); };
             case CubicWeightBase::inIndicesPropertyKey:
+                return [](Core* object) { return object->as<CubicWeightBase>()->inIndices(); };
             case CubicWeightBase::outValuesPropertyKey:
+                return [](Core* object) { return object->as<CubicWeightBase>()->outValues(); };
             case CubicWeightBase::outIndicesPropertyKey:
+                return [](Core* object) { return object->as<CubicWeightBase>()->outIndices(); };
             case FileAssetBase::assetIdPropertyKey:
-                return CoreUintType::id;
+                return [](Core* object) { return object->as<FileAssetBase>()->assetId(); };
+        }
+        return nullptr;
+    }
+    static CoreDoubleType::Getter doubleGetter(int propertyKey)
+    {
+        switch (propertyKey)
+        {
             case ConstraintBase::strengthPropertyKey:
+                return [](Core* object) { return object->as<ConstraintBase>()->strength(); };
             case DistanceConstraintBase::distancePropertyKey:
+                return [](Core* object) {
+                    return object->as<DistanceConstraintBase>()->distance();
+                };
             case TransformComponentConstraintBase::copyFactorPropertyKey:
+                return [](Core* object) {
+                    return object->as<TransformComponentConstraintBase>()->copyFactor();
+                };
             case TransformComponentConstraintBase::minValuePropertyKey:
+                return [](Core* object) {
+                    return object->as<TransformComponentConstraintBase>()->minValue();
+                };
             case TransformComponentConstraintBase::maxValuePropertyKey:
+                return [](Core* object) {
+                    return object->as<TransformComponentConstraintBase>()->maxValue();
+                };
             case TransformComponentConstraintYBase::copyFactorYPropertyKey:
+                return [](Core* object) {
+                    return object->as<TransformComponentConstraintYBase>()->copyFactorY();
+                };
             case TransformComponentConstraintYBase::minValueYPropertyKey:
+                return [](Core* object) {
+                    return object->as<TransformComponentConstraintYBase>()->minValueY();
+                };
             case TransformComponentConstraintYBase::maxValueYPropertyKey:
+                return [](Core* object) {
+                    return object->as<TransformComponentConstraintYBase>()->maxValueY();
+                };
             case WorldTransformComponentBase::opacityPropertyKey:
+                return [](Core* object) {
+                    return object->as<WorldTransformComponentBase>()->opacity();
+                };
             case TransformComponentBase::rotationPropertyKey:
+                return [](Core* object) {
+                    return object->as<TransformComponentBase>()->rotation();
+                };
             case TransformComponentBase::scaleXPropertyKey:
+                return [](Core* object) { return object->as<TransformComponentBase>()->scaleX(); };
             case TransformComponentBase::scaleYPropertyKey:
+                return [](Core* object) { return object->as<TransformComponentBase>()->scaleY(); };
             case NodeBase::xPropertyKey:
+                return [](Core* object) { return object->as<NodeBase>()->x(); };
             case NodeBase::yPropertyKey:
+                return [](Core* object) { return object->as<NodeBase>()->y(); };
             case NestedLinearAnimationBase::mixPropertyKey:
+                return [](Core* object) { return object->as<NestedLinearAnimationBase>()->mix(); };
             case NestedSimpleAnimationBase::speedPropertyKey:
+                return [](Core* object) {
+                    return object->as<NestedSimpleAnimationBase>()->speed();
+                };
             case StateMachineNumberBase::valuePropertyKey:
+                return [](Core* object) { return object->as<StateMachineNumberBase>()->value(); };
             case TransitionNumberConditionBase::valuePropertyKey:
+                return [](Core* object) {
+                    return object->as<TransitionNumberConditionBase>()->value();
+                };
             case ListenerNumberChangeBase::valuePropertyKey:
+                return [](Core* object) { return object->as<ListenerNumberChangeBase>()->value(); };
             case CubicInterpolatorBase::x1PropertyKey:
+                return [](Core* object) { return object->as<CubicInterpolatorBase>()->x1(); };
             case CubicInterpolatorBase::y1PropertyKey:
+                return [](Core* object) { return object->as<CubicInterpolatorBase>()->y1(); };
             case CubicInterpolatorBase::x2PropertyKey:
+                return [](Core* object) { return object->as<CubicInterpolatorBase>()->x2(); };
             case CubicInterpolatorBase::y2PropertyKey:
+                return [](Core* object) { return object->as<CubicInterpolatorBase>()->y2(); };
             case KeyFrameDoubleBase::valuePropertyKey:
+                return [](Core* object) { return object->as<KeyFrameDoubleBase>()->value(); };
             case LinearAnimationBase::speedPropertyKey:
+                return [](Core* object) { return object->as<LinearAnimationBase>()->speed(); };
             case NestedNumberBase::nestedValuePropertyKey:
+                return [](Core* object) { return object->as<NestedNumberBase>()->nestedValue(); };
             case NestedRemapAnimationBase::timePropertyKey:
+                return [](Core* object) { return object->as<NestedRemapAnimationBase>()->time(); };
             case BlendAnimation1DBase::valuePropertyKey:
+                return [](Core* object) { return object->as<BlendAnimation1DBase>()->value(); };
             case LinearGradientBase::startXPropertyKey:
+                return [](Core* object) { return object->as<LinearGradientBase>()->startX(); };
             case LinearGradientBase::startYPropertyKey:
+                return [](Core* object) { return object->as<LinearGradientBase>()->startY(); };
             case LinearGradientBase::endXPropertyKey:
+                return [](Core* object) { return object->as<LinearGradientBase>()->endX(); };
             case LinearGradientBase::endYPropertyKey:
+                return [](Core* object) { return object->as<LinearGradientBase>()->endY(); };
             case LinearGradientBase::opacityPropertyKey:
+                return [](Core* object) { return object->as<LinearGradientBase>()->opacity(); };
             case StrokeBase::thicknessPropertyKey:
+                return [](Core* object) { return object->as<StrokeBase>()->thickness(); };
             case GradientStopBase::positionPropertyKey:
+                return [](Core* object) { return object->as<GradientStopBase>()->position(); };
             case TrimPathBase::startPropertyKey:
+                return [](Core* object) { return object->as<TrimPathBase>()->start(); };
             case TrimPathBase::endPropertyKey:
+                return [](Core* object) { return object->as<TrimPathBase>()->end(); };
             case TrimPathBase::offsetPropertyKey:
+                return [](Core* object) { return object->as<TrimPathBase>()->offset(); };
             case VertexBase::xPropertyKey:
+                return [](Core* object) { return object->as<VertexBase>()->x(); };
             case VertexBase::yPropertyKey:
+                return [](Core* object) { return object->as<VertexBase>()->y(); };
             case MeshVertexBase::uPropertyKey:
+                return [](Core* object) { return object->as<MeshVertexBase>()->u(); };
             case MeshVertexBase::vPropertyKey:
+                return [](Core* object) { return object->as<MeshVertexBase>()->v(); };
             case StraightVertexBase::radiusPropertyKey:
+                return [](Core* object) { return object->as<StraightVertexBase>()->radius(); };
             case CubicAsymmetricVertexBase::rotationPropertyKey:
+                return [](Core* object) {
+                    return object->as<CubicAsymmetricVertexBase>()->rotation();
+                };
             case CubicAsymmetricVertexBase::inDistancePropertyKey:
+                return [](Core* object) {
+                    return object->as<CubicAsymmetricVertexBase>()->inDistance();
+                };
             case CubicAsymmetricVertexBase::outDistancePropertyKey:
+                return [](Core* object) {
+                    return object->as<CubicAsymmetricVertexBase>()->outDistance();
+                };
             case ParametricPathBase::widthPropertyKey:
+                return [](Core* object) { return object->as<ParametricPathBase>()->width(); };
             case ParametricPathBase::heightPropertyKey:
+                return [](Core* object) { return object->as<ParametricPathBase>()->height(); };
             case ParametricPathBase::originXPropertyKey:
+                return [](Core* object) { return object->as<ParametricPathBase>()->originX(); };
             case ParametricPathBase::originYPropertyKey:
+                return [](Core* object) { return object->as<ParametricPathBase>()->originY(); };
             case RectangleBase::cornerRadiusTLPropertyKey:
+                return [](Core* object) { return object->as<RectangleBase>()->cornerRadiusTL(); };
             case RectangleBase::cornerRadiusTRPropertyKey:
+                return [](Core* object) { return object->as<RectangleBase>()->cornerRadiusTR(); };
             case RectangleBase::cornerRadiusBLPropertyKey:
+                return [](Core* object) { return object->as<RectangleBase>()->cornerRadiusBL(); };
             case RectangleBase::cornerRadiusBRPropertyKey:
+                return [](Core* object) { return object->as<RectangleBase>()->cornerRadiusBR(); };
             case CubicMirroredVertexBase::rotationPropertyKey:
+                return [](Core* object) {
+                    return object->as<CubicMirroredVertexBase>()->rotation();
+                };
             case CubicMirroredVertexBase::distancePropertyKey:
+                return [](Core* object) {
+                    return object->as<CubicMirroredVertexBase>()->distance();
+                };
             case PolygonBase::cornerRadiusPropertyKey:
+                return [](Core* object) { return object->as<PolygonBase>()->cornerRadius(); };
             case StarBase::innerRadiusPropertyKey:
+                return [](Core* object) { return object->as<StarBase>()->innerRadius(); };
             case CubicDetachedVertexBase::inRotationPropertyKey:
+                return [](Core* object) {
+                    return object->as<CubicDetachedVertexBase>()->inRotation();
+                };
             case CubicDetachedVertexBase::inDistancePropertyKey:
+                return [](Core* object) {
+                    return object->as<CubicDetachedVertexBase>()->inDistance();
+                };
             case CubicDetachedVertexBase::outRotationPropertyKey:
+                return [](Core* object) {
+                    return object->as<CubicDetachedVertexBase>()->outRotation();
+                };
             case CubicDetachedVertexBase::outDistancePropertyKey:
+                return [](Core* object) {
+                    return object->as<CubicDetachedVertexBase>()->outDistance();
+                };
             case ArtboardBase::widthPropertyKey:
+                return [](Core* object) { return object->as<ArtboardBase>()->width(); };
             case ArtboardBase::heightPropertyKey:
+                return [](Core* object) { return object->as<ArtboardBase>()->height(); };
             case ArtboardBase::xPropertyKey:
+                return [](Core* object) { return object->as<ArtboardBase>()->x(); };
             case ArtboardBase::yPropertyKey:
+                return [](Core* object) { return object->as<ArtboardBase>()->y(); };
             case ArtboardBase::originXPropertyKey:
+                return [](Core* object) { return object->as<ArtboardBase>()->originX(); };
             case ArtboardBase::originYPropertyKey:
+                return [](Core* object) { return object->as<ArtboardBase>()->originY(); };
             case BoneBase::lengthPropertyKey:
+                return [](Core* object) { return object->as<BoneBase>()->length(); };
             case RootBoneBase::xPropertyKey:
+                return [](Core* object) { return object->as<RootBoneBase>()->x(); };
             case RootBoneBase::yPropertyKey:
+                return [](Core* object) { return object->as<RootBoneBase>()->y(); };
             case SkinBase::xxPropertyKey:
+                return [](Core* object) { return object->as<SkinBase>()->xx(); };
             case SkinBase::yxPropertyKey:
+                return [](Core* object) { return object->as<SkinBase>()->yx(); };
             case SkinBase::xyPropertyKey:
+                return [](Core* object) { return object->as<SkinBase>()->xy(); };
             case SkinBase::yyPropertyKey:
+                return [](Core* object) { return object->as<SkinBase>()->yy(); };
             case SkinBase::txPropertyKey:
+                return [](Core* object) { return object->as<SkinBase>()->tx(); };
             case SkinBase::tyPropertyKey:
+                return [](Core* object) { return object->as<SkinBase>()->ty(); };
             case TendonBase::xxPropertyKey:
+                return [](Core* object) { return object->as<TendonBase>()->xx(); };
             case TendonBase::yxPropertyKey:
+                return [](Core* object) { return object->as<TendonBase>()->yx(); };
             case TendonBase::xyPropertyKey:
+                return [](Core* object) { return object->as<TendonBase>()->xy(); };
             case TendonBase::yyPropertyKey:
+                return [](Core* object) { return object->as<TendonBase>()->yy(); };
             case TendonBase::txPropertyKey:
+                return [](Core* object) { return object->as<TendonBase>()->tx(); };
             case TendonBase::tyPropertyKey:
+                return [](Core* object) { return object->as<TendonBase>()->ty(); };
             case DrawableAssetBase::heightPropertyKey:
+                return [](Core* object) { return object->as<DrawableAssetBase>()->height(); };
             case DrawableAssetBase::widthPropertyKey:
-                return CoreDoubleType::id;
+                return [](Core* object) { return object->as<DrawableAssetBase>()->width(); };
+        }
+        return nullptr;
+    }
+    static CoreBoolType::Getter boolGetter(int propertyKey)
+    {
+        switch (propertyKey)
+        {
             case TransformComponentConstraintBase::offsetPropertyKey:
+                return [](Core* object) {
+                    return object->as<TransformComponentConstraintBase>()->offset();
+                };
             case TransformComponentConstraintBase::doesCopyPropertyKey:
+                return [](Core* object) {
+                    return object->as<TransformComponentConstraintBase>()->doesCopy();
+                };
             case TransformComponentConstraintBase::minPropertyKey:
+                return [](Core* object) {
+                    return object->as<TransformComponentConstraintBase>()->min();
+                };
             case TransformComponentConstraintBase::maxPropertyKey:
+                return [](Core* object) {
+                    return object->as<TransformComponentConstraintBase>()->max();
+                };
             case TransformComponentConstraintYBase::doesCopyYPropertyKey:
+                return [](Core* object) {
+                    return object->as<TransformComponentConstraintYBase>()->doesCopyY();
+                };
             case TransformComponentConstraintYBase::minYPropertyKey:
+                return [](Core* object) {
+                    return object->as<TransformComponentConstraintYBase>()->minY();
+                };
             case TransformComponentConstraintYBase::maxYPropertyKey:
+                return [](Core* object) {
+                    return object->as<TransformComponentConstraintYBase>()->maxY();
+                };
             case IKConstraintBase::invertDirectionPropertyKey:
+                return [](Core* object) {
+                    return object->as<IKConstraintBase>()->invertDirection();
+                };
             case NestedSimpleAnimationBase::isPlayingPropertyKey:
+                return [](Core* object) {
+                    return object->as<NestedSimpleAnimationBase>()->isPlaying();
+                };
             case KeyFrameBoolBase::valuePropertyKey:
+                return [](Core* object) { return object->as<KeyFrameBoolBase>()->value(); };
             case NestedBoolBase::nestedValuePropertyKey:
+                return [](Core* object) { return object->as<NestedBoolBase>()->nestedValue(); };
             case LinearAnimationBase::enableWorkAreaPropertyKey:
+                return [](Core* object) {
+                    return object->as<LinearAnimationBase>()->enableWorkArea();
+                };
             case StateMachineBoolBase::valuePropertyKey:
+                return [](Core* object) { return object->as<StateMachineBoolBase>()->value(); };
             case ShapePaintBase::isVisiblePropertyKey:
+                return [](Core* object) { return object->as<ShapePaintBase>()->isVisible(); };
             case StrokeBase::transformAffectsStrokePropertyKey:
+                return [](Core* object) {
+                    return object->as<StrokeBase>()->transformAffectsStroke();
+                };
             case PointsPathBase::isClosedPropertyKey:
+                return [](Core* object) { return object->as<PointsPathBase>()->isClosed(); };
             case RectangleBase::linkCornerRadiusPropertyKey:
+                return [](Core* object) { return object->as<RectangleBase>()->linkCornerRadius(); };
             case ClippingShapeBase::isVisiblePropertyKey:
+                return [](Core* object) { return object->as<ClippingShapeBase>()->isVisible(); };
             case ArtboardBase::clipPropertyKey:
-                return CoreBoolType::id;
+                return [](Core* object) { return object->as<ArtboardBase>()->clip(); };
+        }
+        return nullptr;
+    }
+    static CoreColorType::Getter colorGetter(int propertyKey)
+    {
+        switch (propertyKey)
+        {
             case KeyFrameColorBase::valuePropertyKey:
+                return [](Core* object) { return object->as<KeyFrameColorBase>()->value(); };
             case SolidColorBase::colorValuePropertyKey:
+                return [](Core* object) { return object->as<SolidColorBase>()->colorValue(); };
             case GradientStopBase::colorValuePropertyKey:
-                return CoreColorType::id;
-            case MeshBase::triangleIndexBytesPropertyKey:
-            case FileAssetContentsBase::bytesPropertyKey:
-                return CoreBytesType::id;
-            default:
-                return -1;
+                return [](Core* object) { return object->as<GradientStopBase>()->colorValue(); };
         }
+        return nullptr;
+    }
+    static int propertyFieldId(int propertyKey)
+    {
+        // The field type id of each property key, -1 for unknown keys.
+        static const int8_t fieldIds[] = {
+            -1,
+            -1,
+            -1,
+            -1,
+            CoreStringType::id, // ComponentBase::namePropertyKey
+            CoreUintType::id,   // ComponentBase::parentIdPropertyKey
+            -1,
+            CoreDoubleType::id, // ArtboardBase::widthPropertyKey
+            CoreDoubleType::id, // ArtboardBase::heightPropertyKey
+            CoreDoubleType::id, // ArtboardBase::xPropertyKey
+            CoreDoubleType::id, // ArtboardBase::yPropertyKey
+            CoreDoubleType::id, // ArtboardBase::originXPropertyKey
+            CoreDoubleType::id, // ArtboardBase::originYPropertyKey
+            CoreDoubleType::id, // NodeBase::xPropertyKey
+            CoreDoubleType::id, // NodeBase::yPropertyKey
+            CoreDoubleType::id, // TransformComponentBase::rotationPropertyKey
+            CoreDoubleType::id, // TransformComponentBase::scaleXPropertyKey
+            CoreDoubleType::id, // TransformComponentBase::scaleYPropertyKey
+            CoreDoubleType::id, // WorldTransformComponentBase::opacityPropertyKey
+            -1,
+            CoreDoubleType::id, // ParametricPathBase::widthPropertyKey
+            CoreDoubleType::id, // ParametricPathBase::heightPropertyKey
+            -1,
+            CoreUintType::id,   // DrawableBase::blendModeValuePropertyKey
+            CoreDoubleType::id, // VertexBase::xPropertyKey
+            CoreDoubleType::id, // VertexBase::yPropertyKey
+            CoreDoubleType::id, // StraightVertexBase::radiusPropertyKey
+            -1,
+            -1,
+            -1,
+            -1,
+            CoreDoubleType::id, // RectangleBase::cornerRadiusTLPropertyKey
+            CoreBoolType::id,   // PointsPathBase::isClosedPropertyKey
+            CoreDoubleType::id, // LinearGradientBase::startYPropertyKey
+            CoreDoubleType::id, // LinearGradientBase::endXPropertyKey
+            CoreDoubleType::id, // LinearGradientBase::endYPropertyKey
+            -1,
+            CoreColorType::id,  // SolidColorBase::colorValuePropertyKey
+            CoreColorType::id,  // GradientStopBase::colorValuePropertyKey
+            CoreDoubleType::id, // GradientStopBase::positionPropertyKey
+            CoreUintType::id,   // FillBase::fillRulePropertyKey
+            CoreBoolType::id,   // ShapePaintBase::isVisiblePropertyKey
+            CoreDoubleType::id, // LinearGradientBase::startXPropertyKey
+            -1,
+            -1,
+            -1,
+            CoreDoubleType::id, // LinearGradientBase::opacityPropertyKey
+            CoreDoubleType::id, // StrokeBase::thicknessPropertyKey
+            CoreUintType::id,   // StrokeBase::capPropertyKey
+            CoreUintType::id,   // StrokeBase::joinPropertyKey
+            CoreBoolType::id,   // StrokeBase::transformAffectsStrokePropertyKey
+            CoreUintType::id,   // KeyedObjectBase::objectIdPropertyKey
+            -1,
+            CoreUintType::id,   // KeyedPropertyBase::propertyKeyPropertyKey
+            -1,
+            CoreStringType::id, // AnimationBase::namePropertyKey
+            CoreUintType::id,   // LinearAnimationBase::fpsPropertyKey
+            CoreUintType::id,   // LinearAnimationBase::durationPropertyKey
+            CoreDoubleType::id, // LinearAnimationBase::speedPropertyKey
+            CoreUintType::id,   // LinearAnimationBase::loopValuePropertyKey
+            CoreUintType::id,   // LinearAnimationBase::workStartPropertyKey
+            CoreUintType::id,   // LinearAnimationBase::workEndPropertyKey
+            CoreBoolType::id,   // LinearAnimationBase::enableWorkAreaPropertyKey
+            CoreDoubleType::id, // CubicInterpolatorBase::x1PropertyKey
+            CoreDoubleType::id, // CubicInterpolatorBase::y1PropertyKey
+            CoreDoubleType::id, // CubicInterpolatorBase::x2PropertyKey
+            CoreDoubleType::id, // CubicInterpolatorBase::y2PropertyKey
+            CoreUintType::id,   // KeyFrameBase::framePropertyKey
+            CoreUintType::id,   // KeyFrameBase::interpolationTypePropertyKey
+            CoreUintType::id,   // KeyFrameBase::interpolatorIdPropertyKey
+            CoreDoubleType::id, // KeyFrameDoubleBase::valuePropertyKey
+            -1,
+            -1,
+            -1,
+            -1,
+            -1,
+            -1,
+            -1,
+            -1,
+            CoreDoubleType::id, // CubicAsymmetricVertexBase::rotationPropertyKey
+            CoreDoubleType::id, // CubicAsymmetricVertexBase::inDistancePropertyKey
+            CoreDoubleType::id, // CubicAsymmetricVertexBase::outDistancePropertyKey
+            CoreDoubleType::id, // CubicMirroredVertexBase::rotationPropertyKey
+            CoreDoubleType::id, // CubicMirroredVertexBase::distancePropertyKey
+            CoreDoubleType::id, // CubicDetachedVertexBase::inRotationPropertyKey
+            CoreDoubleType::id, // CubicDetachedVertexBase::inDistancePropertyKey
+            CoreDoubleType::id, // CubicDetachedVertexBase::outRotationPropertyKey
+            CoreDoubleType::id, // CubicDetachedVertexBase::outDistancePropertyKey
+            CoreColorType::id,  // KeyFrameColorBase::valuePropertyKey
+            CoreDoubleType::id, // BoneBase::lengthPropertyKey
+            CoreDoubleType::id, // RootBoneBase::xPropertyKey
+            CoreDoubleType::id, // RootBoneBase::yPropertyKey
+            CoreUintType::id,   // ClippingShapeBase::sourceIdPropertyKey
+            CoreUintType::id,   // ClippingShapeBase::fillRulePropertyKey
+            CoreBoolType::id,   // ClippingShapeBase::isVisiblePropertyKey
+            CoreUintType::id,   // TendonBase::boneIdPropertyKey
+            CoreDoubleType::id, // TendonBase::xxPropertyKey
+            CoreDoubleType::id, // TendonBase::yxPropertyKey
+            CoreDoubleType::id, // TendonBase::xyPropertyKey
+            CoreDoubleType::id, // TendonBase::yyPropertyKey
+            CoreDoubleType::id, // TendonBase::txPropertyKey
+            CoreDoubleType::id, // TendonBase::tyPropertyKey
+            CoreUintType::id,   // WeightBase::valuesPropertyKey
+            CoreUintType::id,   // WeightBase::indicesPropertyKey
+            CoreDoubleType::id, // SkinBase::xxPropertyKey
+            CoreDoubleType::id, // SkinBase::yxPropertyKey
+            CoreDoubleType::id, // SkinBase::xyPropertyKey
+            CoreDoubleType::id, // SkinBase::yyPropertyKey
+            CoreDoubleType::id, // SkinBase::txPropertyKey
+            CoreDoubleType::id, // SkinBase::tyPropertyKey
+            CoreUintType::id,   // CubicWeightBase::inValuesPropertyKey
+            CoreUintType::id,   // CubicWeightBase::inIndicesPropertyKey
+            CoreUintType::id,   // CubicWeightBase::outValuesPropertyKey
+            CoreUintType::id,   // CubicWeightBase::outIndicesPropertyKey
+            CoreDoubleType::id, // TrimPathBase::startPropertyKey
+            CoreDoubleType::id, // TrimPathBase::endPropertyKey
+            CoreDoubleType::id, // TrimPathBase::offsetPropertyKey
+            CoreUintType::id,   // TrimPathBase::modeValuePropertyKey
+            -1,
+            CoreUintType::id,   // DrawTargetBase::drawableIdPropertyKey
+            CoreUintType::id,   // DrawTargetBase::placementValuePropertyKey
+            CoreUintType::id,   // DrawRulesBase::drawTargetIdPropertyKey
+            CoreUintType::id,   // KeyFrameIdBase::valuePropertyKey
+            CoreDoubleType::id, // ParametricPathBase::originXPropertyKey
+            CoreDoubleType::id, // ParametricPathBase::originYPropertyKey
+            CoreUintType::id,   // PolygonBase::pointsPropertyKey
+            CoreDoubleType::id, // PolygonBase::cornerRadiusPropertyKey
+            CoreDoubleType::id, // StarBase::innerRadiusPropertyKey
+            CoreUintType::id,   // PathBase::pathFlagsPropertyKey
+            CoreUintType::id,   // DrawableBase::drawableFlagsPropertyKey
+            -1,
+            -1,
+            -1,
+            -1,
+            -1,
+            -1,
+            -1,
+            -1,
+            CoreStringType::id, // StateMachineComponentBase::namePropertyKey
+            -1,
+            CoreDoubleType::id, // StateMachineNumberBase::valuePropertyKey
+            CoreBoolType::id,   // StateMachineBoolBase::valuePropertyKey
+            -1,
+            -1,
+            -1,
+            -1,
+            -1,
+            -1,
+            -1,
+            CoreUintType::id,   // AnimationStateBase::animationIdPropertyKey
+            -1,
+            CoreUintType::id,   // StateTransitionBase::stateToIdPropertyKey
+            CoreUintType::id,   // StateTransitionBase::flagsPropertyKey
+            -1,
+            -1,
+            CoreUintType::id,   // TransitionConditionBase::inputIdPropertyKey
+            CoreUintType::id,   // TransitionValueConditionBase::opValuePropertyKey
+            CoreDoubleType::id, // TransitionNumberConditionBase::valuePropertyKey
+            CoreUintType::id,   // StateTransitionBase::durationPropertyKey
+            -1,
+            CoreUintType::id,   // StateTransitionBase::exitTimePropertyKey
+            CoreDoubleType::id, // RectangleBase::cornerRadiusTRPropertyKey
+            CoreDoubleType::id, // RectangleBase::cornerRadiusBLPropertyKey
+            CoreDoubleType::id, // RectangleBase::cornerRadiusBRPropertyKey
+            CoreBoolType::id,   // RectangleBase::linkCornerRadiusPropertyKey
+            CoreUintType::id,   // BlendAnimationBase::animationIdPropertyKey
+            CoreDoubleType::id, // BlendAnimation1DBase::valuePropertyKey
+            CoreUintType::id,   // BlendState1DBase::inputIdPropertyKey
+            CoreUintType::id,   // BlendAnimationDirectBase::inputIdPropertyKey
+            -1,
+            -1,
+            CoreUintType::id,   // BlendStateTransitionBase::exitBlendAnimationIdPropertyKey
+            CoreDoubleType::id, // ConstraintBase::strengthPropertyKey
+            CoreUintType::id,   // TargetedConstraintBase::targetIdPropertyKey
+            CoreBoolType::id,   // IKConstraintBase::invertDirectionPropertyKey
+            CoreUintType::id,   // IKConstraintBase::parentBoneCountPropertyKey
+            -1,
+            CoreDoubleType::id, // DistanceConstraintBase::distancePropertyKey
+            CoreUintType::id,   // DistanceConstraintBase::modeValuePropertyKey
+            CoreUintType::id,   // TransformSpaceConstraintBase::sourceSpaceValuePropertyKey
+            CoreUintType::id,   // TransformSpaceConstraintBase::destSpaceValuePropertyKey
+            CoreBoolType::id,   // KeyFrameBoolBase::valuePropertyKey
+            CoreDoubleType::id, // TransformComponentConstraintBase::copyFactorPropertyKey
+            CoreDoubleType::id, // TransformComponentConstraintBase::minValuePropertyKey
+            CoreDoubleType::id, // TransformComponentConstraintBase::maxValuePropertyKey
+            CoreDoubleType::id, // TransformComponentConstraintYBase::copyFactorYPropertyKey
+            CoreDoubleType::id, // TransformComponentConstraintYBase::minValueYPropertyKey
+            CoreDoubleType::id, // TransformComponentConstraintYBase::maxValueYPropertyKey
+            CoreBoolType::id,   // TransformComponentConstraintBase::offsetPropertyKey
+            CoreBoolType::id,   // TransformComponentConstraintBase::doesCopyPropertyKey
+            CoreBoolType::id,   // TransformComponentConstraintBase::minPropertyKey
+            CoreBoolType::id,   // TransformComponentConstraintBase::maxPropertyKey
+            CoreBoolType::id,   // TransformComponentConstraintYBase::doesCopyYPropertyKey
+            CoreBoolType::id,   // TransformComponentConstraintYBase::minYPropertyKey
+            CoreBoolType::id,   // TransformComponentConstraintYBase::maxYPropertyKey
+            CoreUintType::id,   // TransformComponentConstraintBase::minMaxSpaceValuePropertyKey
+            CoreBoolType::id,   // ArtboardBase::clipPropertyKey
+            CoreUintType::id,   // NestedArtboardBase::artboardIdPropertyKey
+            CoreUintType::id,   // NestedAnimationBase::animationIdPropertyKey
+            CoreDoubleType::id, // NestedSimpleAnimationBase::speedPropertyKey
+            CoreDoubleType::id, // NestedLinearAnimationBase::mixPropertyKey
+            CoreBoolType::id,   // NestedSimpleAnimationBase::isPlayingPropertyKey
+            CoreDoubleType::id, // NestedRemapAnimationBase::timePropertyKey
+            CoreStringType::id, // AssetBase::namePropertyKey
+            CoreUintType::id,   // FileAssetBase::assetIdPropertyKey
+            -1,
+            CoreUintType::id,   // ImageBase::assetIdPropertyKey
+            CoreDoubleType::id, // DrawableAssetBase::heightPropertyKey
+            CoreDoubleType::id, // DrawableAssetBase::widthPropertyKey
+            -1,
+            -1,
+            -1,
+            CoreBytesType::id,  // FileAssetContentsBase::bytesPropertyKey
+            -1,
+            -1,
+            CoreDoubleType::id, // MeshVertexBase::uPropertyKey
+            CoreDoubleType::id, // MeshVertexBase::vPropertyKey
+            -1,
+            -1,
+            -1,
+            -1,
+            -1,
+            -1,
+            CoreBytesType::id,  // MeshBase::triangleIndexBytesPropertyKey
+            CoreUintType::id,   // StateMachineListenerBase::targetIdPropertyKey
+            CoreUintType::id,   // StateMachineListenerBase::listenerTypeValuePropertyKey
+            -1,
+            CoreUintType::id,   // ListenerInputChangeBase::inputIdPropertyKey
+            CoreUintType::id,   // ListenerBoolChangeBase::valuePropertyKey
+            CoreDoubleType::id, // ListenerNumberChangeBase::valuePropertyKey
+            -1,
+            -1,
+            -1,
+            -1,
+            -1,
+            -1,
+            CoreUintType::id,   // ArtboardBase::defaultStateMachineIdPropertyKey
+            CoreUintType::id,   // NestedInputBase::inputIdPropertyKey
+            CoreBoolType::id,   // NestedBoolBase::nestedValuePropertyKey
+            CoreDoubleType::id, // NestedNumberBase::nestedValuePropertyKey
+            CoreUintType::id,   // ListenerAlignTargetBase::targetIdPropertyKey
+        };
+        return propertyKey >= 0 && propertyKey < (int)sizeof(fieldIds) ? fieldIds[propertyKey]
+                                                                     : -1;
     }
 };
 } // namespace rive
@@ -47,12 +47,25 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const DrawRulesBase& object)
     {
         m_DrawTargetId = object.m_DrawTargetId;
         ContainerComponent::copy(object);
     }
 
+    void assign(const DrawRulesBase& object)
+    {
+        if (m_DrawTargetId != object.m_DrawTargetId)
+        {
+            m_DrawTargetId = object.m_DrawTargetId;
+            drawTargetIdChanged();
+        }
+        ContainerComponent::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
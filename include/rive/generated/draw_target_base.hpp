@@ -59,6 +59,9 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const DrawTargetBase& object)
     {
         m_DrawableId = object.m_DrawableId;
@@ -66,6 +69,21 @@ public:
         Component::copy(object);
     }
 
+    void assign(const DrawTargetBase& object)
+    {
+        if (m_DrawableId != object.m_DrawableId)
+        {
+            m_DrawableId = object.m_DrawableId;
+            drawableIdChanged();
+        }
+        if (m_PlacementValue != object.m_PlacementValue)
+        {
+            m_PlacementValue = object.m_PlacementValue;
+            placementValueChanged();
+        }
+        Component::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -69,6 +69,21 @@ public:
         Node::copy(object);
     }
 
+    void assign(const DrawableBase& object)
+    {
+        if (m_BlendModeValue != object.m_BlendModeValue)
+        {
+            m_BlendModeValue = object.m_BlendModeValue;
+            blendModeValueChanged();
+        }
+        if (m_DrawableFlags != object.m_DrawableFlags)
+        {
+            m_DrawableFlags = object.m_DrawableFlags;
+            drawableFlagsChanged();
+        }
+        Node::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -52,6 +52,16 @@ public:
         ContainerComponent::copy(object);
     }
 
+    void assign(const NestedAnimationBase& object)
+    {
+        if (m_AnimationId != object.m_AnimationId)
+        {
+            m_AnimationId = object.m_AnimationId;
+            animationIdChanged();
+        }
+        ContainerComponent::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -51,12 +51,25 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const NestedArtboardBase& object)
     {
         m_ArtboardId = object.m_ArtboardId;
         Drawable::copy(object);
     }
 
+    void assign(const NestedArtboardBase& object)
+    {
+        if (m_ArtboardId != object.m_ArtboardId)
+        {
+            m_ArtboardId = object.m_ArtboardId;
+            artboardIdChanged();
+        }
+        Drawable::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -62,6 +62,9 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const NodeBase& object)
     {
         m_X = object.m_X;
@@ -69,6 +72,21 @@ public:
         TransformComponent::copy(object);
     }
 
+    void assign(const NodeBase& object)
+    {
+        if (m_X != object.m_X)
+        {
+            m_X = object.m_X;
+            xChanged();
+        }
+        if (m_Y != object.m_Y)
+        {
+            m_Y = object.m_Y;
+            yChanged();
+        }
+        TransformComponent::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
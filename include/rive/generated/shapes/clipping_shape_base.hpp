@@ -73,6 +73,9 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const ClippingShapeBase& object)
     {
         m_SourceId = object.m_SourceId;
@@ -81,6 +84,26 @@ public:
         Component::copy(object);
     }
 
+    void assign(const ClippingShapeBase& object)
+    {
+        if (m_SourceId != object.m_SourceId)
+        {
+            m_SourceId = object.m_SourceId;
+            sourceIdChanged();
+        }
+        if (m_FillRule != object.m_FillRule)
+        {
+            m_FillRule = object.m_FillRule;
+            fillRuleChanged();
+        }
+        if (m_IsVisible != object.m_IsVisible)
+        {
+            m_IsVisible = object.m_IsVisible;
+            isVisibleChanged();
+        }
+        Component::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
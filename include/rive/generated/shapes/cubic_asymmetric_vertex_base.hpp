@@ -76,6 +76,9 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const CubicAsymmetricVertexBase& object)
     {
         m_Rotation = object.m_Rotation;
@@ -84,6 +87,26 @@ public:
         CubicVertex::copy(object);
     }
 
+    void assign(const CubicAsymmetricVertexBase& object)
+    {
+        if (m_Rotation != object.m_Rotation)
+        {
+            m_Rotation = object.m_Rotation;
+            rotationChanged();
+        }
+        if (m_InDistance != object.m_InDistance)
+        {
+            m_InDistance = object.m_InDistance;
+            inDistanceChanged();
+        }
+        if (m_OutDistance != object.m_OutDistance)
+        {
+            m_OutDistance = object.m_OutDistance;
+            outDistanceChanged();
+        }
+        CubicVertex::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
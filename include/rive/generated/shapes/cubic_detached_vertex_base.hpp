@@ -89,6 +89,9 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const CubicDetachedVertexBase& object)
     {
         m_InRotation = object.m_InRotation;
@@ -98,6 +101,31 @@ public:
         CubicVertex::copy(object);
     }
 
+    void assign(const CubicDetachedVertexBase& object)
+    {
+        if (m_InRotation != object.m_InRotation)
+        {
+            m_InRotation = object.m_InRotation;
+            inRotationChanged();
+        }
+        if (m_InDistance != object.m_InDistance)
+        {
+            m_InDistance = object.m_InDistance;
+            inDistanceChanged();
+        }
+        if (m_OutRotation != object.m_OutRotation)
+        {
+            m_OutRotation = object.m_OutRotation;
+            outRotationChanged();
+        }
+        if (m_OutDistance != object.m_OutDistance)
+        {
+            m_OutDistance = object.m_OutDistance;
+            outDistanceChanged();
+        }
+        CubicVertex::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -63,6 +63,9 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const CubicMirroredVertexBase& object)
     {
         m_Rotation = object.m_Rotation;
@@ -70,6 +73,21 @@ public:
         CubicVertex::copy(object);
     }
 
+    void assign(const CubicMirroredVertexBase& object)
+    {
+        if (m_Rotation != object.m_Rotation)
+        {
+            m_Rotation = object.m_Rotation;
+            rotationChanged();
+        }
+        if (m_Distance != object.m_Distance)
+        {
+            m_Distance = object.m_Distance;
+            distanceChanged();
+        }
+        CubicVertex::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -51,12 +51,25 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const ImageBase& object)
     {
         m_AssetId = object.m_AssetId;
         Drawable::copy(object);
     }
 
+    void assign(const ImageBase& object)
+    {
+        if (m_AssetId != object.m_AssetId)
+        {
+            m_AssetId = object.m_AssetId;
+            assetIdChanged();
+        }
+        Drawable::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -37,12 +37,20 @@ public:
     virtual void copyTriangleIndexBytes(const MeshBase& object) = 0;
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const MeshBase& object)
     {
         copyTriangleIndexBytes(object);
         ContainerComponent::copy(object);
     }
 
+    void assign(const MeshBase& object)
+    {
+        ContainerComponent::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
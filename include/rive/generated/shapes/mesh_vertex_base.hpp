@@ -61,6 +61,9 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const MeshVertexBase& object)
     {
         m_U = object.m_U;
@@ -68,6 +71,21 @@ public:
         Vertex::copy(object);
     }
 
+    void assign(const MeshVertexBase& object)
+    {
+        if (m_U != object.m_U)
+        {
+            m_U = object.m_U;
+            uChanged();
+        }
+        if (m_V != object.m_V)
+        {
+            m_V = object.m_V;
+            vChanged();
+        }
+        Vertex::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
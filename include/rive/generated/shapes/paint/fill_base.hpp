@@ -48,12 +48,25 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const FillBase& object)
     {
         m_FillRule = object.m_FillRule;
         ShapePaint::copy(object);
     }
 
+    void assign(const FillBase& object)
+    {
+        if (m_FillRule != object.m_FillRule)
+        {
+            m_FillRule = object.m_FillRule;
+            fillRuleChanged();
+        }
+        ShapePaint::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
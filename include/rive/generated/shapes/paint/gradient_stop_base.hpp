@@ -60,6 +60,9 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const GradientStopBase& object)
     {
         m_ColorValue = object.m_ColorValue;
@@ -67,6 +70,21 @@ public:
         Component::copy(object);
     }
 
+    void assign(const GradientStopBase& object)
+    {
+        if (m_ColorValue != object.m_ColorValue)
+        {
+            m_ColorValue = object.m_ColorValue;
+            colorValueChanged();
+        }
+        if (m_Position != object.m_Position)
+        {
+            m_Position = object.m_Position;
+            positionChanged();
+        }
+        Component::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
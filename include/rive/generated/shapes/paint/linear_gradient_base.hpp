@@ -99,6 +99,9 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const LinearGradientBase& object)
     {
         m_StartX = object.m_StartX;
@@ -109,6 +112,36 @@ public:
         ContainerComponent::copy(object);
     }
 
+    void assign(const LinearGradientBase& object)
+    {
+        if (m_StartX != object.m_StartX)
+        {
+            m_StartX = object.m_StartX;
+            startXChanged();
+        }
+        if (m_StartY != object.m_StartY)
+        {
+            m_StartY = object.m_StartY;
+            startYChanged();
+        }
+        if (m_EndX != object.m_EndX)
+        {
+            m_EndX = object.m_EndX;
+            endXChanged();
+        }
+        if (m_EndY != object.m_EndY)
+        {
+            m_EndY = object.m_EndY;
+            endYChanged();
+        }
+        if (m_Opacity != object.m_Opacity)
+        {
+            m_Opacity = object.m_Opacity;
+            opacityChanged();
+        }
+        ContainerComponent::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -52,6 +52,16 @@ public:
         ContainerComponent::copy(object);
     }
 
+    void assign(const ShapePaintBase& object)
+    {
+        if (m_IsVisible != object.m_IsVisible)
+        {
+            m_IsVisible = object.m_IsVisible;
+            isVisibleChanged();
+        }
+        ContainerComponent::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
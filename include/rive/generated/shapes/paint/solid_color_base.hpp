@@ -46,12 +46,25 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const SolidColorBase& object)
     {
         m_ColorValue = object.m_ColorValue;
         Component::copy(object);
     }
 
+    void assign(const SolidColorBase& object)
+    {
+        if (m_ColorValue != object.m_ColorValue)
+        {
+            m_ColorValue = object.m_ColorValue;
+            colorValueChanged();
+        }
+        Component::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
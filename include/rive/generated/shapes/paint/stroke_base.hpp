@@ -89,6 +89,9 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const StrokeBase& object)
     {
         m_Thickness = object.m_Thickness;
@@ -98,6 +101,31 @@ public:
         ShapePaint::copy(object);
     }
 
+    void assign(const StrokeBase& object)
+    {
+        if (m_Thickness != object.m_Thickness)
+        {
+            m_Thickness = object.m_Thickness;
+            thicknessChanged();
+        }
+        if (m_Cap != object.m_Cap)
+        {
+            m_Cap = object.m_Cap;
+            capChanged();
+        }
+        if (m_Join != object.m_Join)
+        {
+            m_Join = object.m_Join;
+            joinChanged();
+        }
+        if (m_TransformAffectsStroke != object.m_TransformAffectsStroke)
+        {
+            m_TransformAffectsStroke = object.m_TransformAffectsStroke;
+            transformAffectsStrokeChanged();
+        }
+        ShapePaint::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
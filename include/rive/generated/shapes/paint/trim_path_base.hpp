@@ -86,6 +86,9 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const TrimPathBase& object)
     {
         m_Start = object.m_Start;
@@ -95,6 +98,31 @@ public:
         Component::copy(object);
     }
 
+    void assign(const TrimPathBase& object)
+    {
+        if (m_Start != object.m_Start)
+        {
+            m_Start = object.m_Start;
+            startChanged();
+        }
+        if (m_End != object.m_End)
+        {
+            m_End = object.m_End;
+            endChanged();
+        }
+        if (m_Offset != object.m_Offset)
+        {
+            m_Offset = object.m_Offset;
+            offsetChanged();
+        }
+        if (m_ModeValue != object.m_ModeValue)
+        {
+            m_ModeValue = object.m_ModeValue;
+            modeValueChanged();
+        }
+        Component::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -98,6 +98,31 @@ public:
         Path::copy(object);
     }
 
+    void assign(const ParametricPathBase& object)
+    {
+        if (m_Width != object.m_Width)
+        {
+            m_Width = object.m_Width;
+            widthChanged();
+        }
+        if (m_Height != object.m_Height)
+        {
+            m_Height = object.m_Height;
+            heightChanged();
+        }
+        if (m_OriginX != object.m_OriginX)
+        {
+            m_OriginX = object.m_OriginX;
+            originXChanged();
+        }
+        if (m_OriginY != object.m_OriginY)
+        {
+            m_OriginY = object.m_OriginY;
+            originYChanged();
+        }
+        Path::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -55,6 +55,16 @@ public:
         Node::copy(object);
     }
 
+    void assign(const PathBase& object)
+    {
+        if (m_PathFlags != object.m_PathFlags)
+        {
+            m_PathFlags = object.m_PathFlags;
+            pathFlagsChanged();
+        }
+        Node::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -51,12 +51,25 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const PointsPathBase& object)
     {
         m_IsClosed = object.m_IsClosed;
         Path::copy(object);
     }
 
+    void assign(const PointsPathBase& object)
+    {
+        if (m_IsClosed != object.m_IsClosed)
+        {
+            m_IsClosed = object.m_IsClosed;
+            isClosedChanged();
+        }
+        Path::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -66,6 +66,9 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const PolygonBase& object)
     {
         m_Points = object.m_Points;
@@ -73,6 +76,21 @@ public:
         ParametricPath::copy(object);
     }
 
+    void assign(const PolygonBase& object)
+    {
+        if (m_Points != object.m_Points)
+        {
+            m_Points = object.m_Points;
+            pointsChanged();
+        }
+        if (m_CornerRadius != object.m_CornerRadius)
+        {
+            m_CornerRadius = object.m_CornerRadius;
+            cornerRadiusChanged();
+        }
+        ParametricPath::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -105,6 +105,9 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const RectangleBase& object)
     {
         m_LinkCornerRadius = object.m_LinkCornerRadius;
@@ -115,6 +118,36 @@ public:
         ParametricPath::copy(object);
     }
 
+    void assign(const RectangleBase& object)
+    {
+        if (m_LinkCornerRadius != object.m_LinkCornerRadius)
+        {
+            m_LinkCornerRadius = object.m_LinkCornerRadius;
+            linkCornerRadiusChanged();
+        }
+        if (m_CornerRadiusTL != object.m_CornerRadiusTL)
+        {
+            m_CornerRadiusTL = object.m_CornerRadiusTL;
+            cornerRadiusTLChanged();
+        }
+        if (m_CornerRadiusTR != object.m_CornerRadiusTR)
+        {
+            m_CornerRadiusTR = object.m_CornerRadiusTR;
+            cornerRadiusTRChanged();
+        }
+        if (m_CornerRadiusBL != object.m_CornerRadiusBL)
+        {
+            m_CornerRadiusBL = object.m_CornerRadiusBL;
+            cornerRadiusBLChanged();
+        }
+        if (m_CornerRadiusBR != object.m_CornerRadiusBR)
+        {
+            m_CornerRadiusBR = object.m_CornerRadiusBR;
+            cornerRadiusBRChanged();
+        }
+        ParametricPath::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
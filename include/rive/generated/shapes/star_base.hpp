@@ -53,12 +53,25 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const StarBase& object)
     {
         m_InnerRadius = object.m_InnerRadius;
         Polygon::copy(object);
     }
 
+    void assign(const StarBase& object)
+    {
+        if (m_InnerRadius != object.m_InnerRadius)
+        {
+            m_InnerRadius = object.m_InnerRadius;
+            innerRadiusChanged();
+        }
+        Polygon::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -49,12 +49,25 @@ public:
     }
 
     Core* clone() const override;
+    size_t cloneSize() const override;
+    Core* cloneInto(void* memory) const override;
+    void assignProperties(const Core* source) override;
     void copy(const StraightVertexBase& object)
     {
         m_Radius = object.m_Radius;
         PathVertex::copy(object);
     }
 
+    void assign(const StraightVertexBase& object)
+    {
+        if (m_Radius != object.m_Radius)
+        {
+            m_Radius = object.m_Radius;
+            radiusChanged();
+        }
+        PathVertex::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -66,6 +66,21 @@ public:
         ContainerComponent::copy(object);
     }
 
+    void assign(const VertexBase& object)
+    {
+        if (m_X != object.m_X)
+        {
+            m_X = object.m_X;
+            xChanged();
+        }
+        if (m_Y != object.m_Y)
+        {
+            m_Y = object.m_Y;
+            yChanged();
+        }
+        ContainerComponent::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
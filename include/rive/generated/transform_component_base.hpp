@@ -81,6 +81,26 @@ public:
         WorldTransformComponent::copy(object);
     }
 
+    void assign(const TransformComponentBase& object)
+    {
+        if (m_Rotation != object.m_Rotation)
+        {
+            m_Rotation = object.m_Rotation;
+            rotationChanged();
+        }
+        if (m_ScaleX != object.m_ScaleX)
+        {
+            m_ScaleX = object.m_ScaleX;
+            scaleXChanged();
+        }
+        if (m_ScaleY != object.m_ScaleY)
+        {
+            m_ScaleY = object.m_ScaleY;
+            scaleYChanged();
+        }
+        WorldTransformComponent::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
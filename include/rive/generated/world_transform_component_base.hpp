@@ -52,6 +52,16 @@ public:
         ContainerComponent::copy(object);
     }
 
+    void assign(const WorldTransformComponentBase& object)
+    {
+        if (m_Opacity != object.m_Opacity)
+        {
+            m_Opacity = object.m_Opacity;
+            opacityChanged();
+        }
+        ContainerComponent::assign(object);
+    }
+
     bool deserialize(uint16_t propertyKey, BinaryReader& reader) override
     {
         switch (propertyKey)
@@ -7,6 +7,7 @@
 
 namespace rive
 {
+class AssetDecoder;
 class FileAsset;
 class FileAssetContents;
 class FileAssetResolver;
@@ -19,11 +20,13 @@ private:
     FileAsset* m_FileAsset;
     FileAssetResolver* m_FileAssetResolver;
     Factory* m_Factory;
+    // Decodes in the background when set.
+    AssetDecoder* m_Decoder;
     // we will delete this when we go out of scope
     std::unique_ptr<FileAssetContents> m_Content;
 
 public:
-    FileAssetImporter(FileAsset*, FileAssetResolver*, Factory*);
+    FileAssetImporter(FileAsset*, FileAssetResolver*, Factory*, AssetDecoder* decoder = nullptr);
     void loadContents(std::unique_ptr<FileAssetContents> contents);
     StatusCode resolve() override;
 };
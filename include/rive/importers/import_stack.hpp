@@ -2,9 +2,13 @@
 #define _RIVE_IMPORT_STACK_HPP_
 #include "rive/status_code.hpp"
 #include <algorithm>
-#include <unordered_map>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdint.h>
+#include <utility>
 #include <vector>
-#include <algorithm>
 
 namespace rive
 {
@@ -19,27 +23,65 @@ public:
 class ImportStack
 {
 private:
-    std::unordered_map<uint16_t, ImportStackObject*> m_Latests;
+    // Stack objects are made in blocks that are all freed when the stack goes
+    // away, the objects themselves are destroyed once they've resolved.
+    static constexpr size_t blockSize = 4096;
+    std::vector<std::unique_ptr<uint8_t[]>> m_Blocks;
+    size_t m_BlockUsed = blockSize;
+
+    // There's only a handful of types on the stack at any one time.
+    std::vector<std::pair<uint16_t, ImportStackObject*>> m_Latests;
     std::vector<ImportStackObject*> m_LastAdded;
 
+    void* allocate(size_t size)
+    {
+        const size_t alignment = alignof(std::max_align_t);
+        size = (size + alignment - 1) & ~(alignment - 1);
+        assert(size <= blockSize);
+        if (m_BlockUsed + size > blockSize)
+        {
+            m_Blocks.emplace_back(new uint8_t[blockSize]);
+            m_BlockUsed = 0;
+        }
+        void* memory = m_Blocks.back().get() + m_BlockUsed;
+        m_BlockUsed += size;
+        return memory;
+    }
+
+    static void destroy(ImportStackObject* object) { object->~ImportStackObject(); }
+
 public:
+    /// Makes a stack object in the stack's memory, to be handed to makeLatest.
+    template <typename T, typename... Args> T* make(Args&&... args)
+    {
+        static_assert(alignof(T) <= alignof(std::max_align_t), "over-aligned stack object");
+        return new (allocate(sizeof(T))) T(std::forward<Args>(args)...);
+    }
+
     template <typename T = ImportStackObject> T* latest(uint16_t coreType)
     {
-        auto itr = m_Latests.find(coreType);
-        if (itr == m_Latests.end())
+        for (auto& latest : m_Latests)
         {
-            return nullptr;
+            if (latest.first == coreType)
+            {
+                return reinterpret_cast<T*>(latest.second);
+            }
         }
-        return reinterpret_cast<T*>(itr->second);
+        return nullptr;
     }
 
+    /// Resolves the stack object of coreType and replaces it with object,
+    /// which must have been made with make (or be null).
     StatusCode makeLatest(uint16_t coreType, ImportStackObject* object)
     {
         // Clean up the old object in the stack.
-        auto itr = m_Latests.find(coreType);
+        auto itr = std::find_if(m_Latests.begin(), m_Latests.end(), [&](const auto& latest) {
+            return latest.first == coreType;
+        });
         if (itr != m_Latests.end())
         {
             auto stackObject = itr->second;
+            m_Latests.erase(itr);
 
             // Remove it from latests.
             auto itr = std::find(m_LastAdded.begin(), m_LastAdded.end(), stackObject);
@@ -49,22 +91,21 @@ public:
             }
 
             StatusCode code = stackObject->resolve();
-            delete stackObject;
+            destroy(stackObject);
             if (code != StatusCode::Ok)
             {
-                m_Latests.erase(coreType);
+                if (object != nullptr)
+                {
+                    destroy(object);
+                }
                 return code;
             }
         }
 
         // Set the new one.
-        if (object == nullptr)
+        if (object != nullptr)
         {
-            m_Latests.erase(coreType);
-        }
-        else
-        {
-            m_Latests[coreType] = object;
+            m_Latests.emplace_back(coreType, object);
             m_LastAdded.push_back(object);
         }
         return StatusCode::Ok;
@@ -72,25 +113,26 @@ public:
 
     StatusCode resolve()
     {
+        StatusCode code = StatusCode::Ok;
         for (auto itr = m_LastAdded.rbegin(); itr != m_LastAdded.rend(); itr++)
         {
-            StatusCode code = (*itr)->resolve();
-            delete *itr;
-            if (code != StatusCode::Ok)
+            // Objects after one that failed are only cleaned up.
+            if (code == StatusCode::Ok)
             {
-                return code;
+                code = (*itr)->resolve();
             }
+            destroy(*itr);
         }
         m_Latests.clear();
         m_LastAdded.clear();
-        return StatusCode::Ok;
+        return code;
     }
 
     ~ImportStack()
     {
-        for (auto& pair : m_Latests)
+        for (auto object : m_LastAdded)
         {
-            delete pair.second;
+            destroy(object);
         }
     }
 
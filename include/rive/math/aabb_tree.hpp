@@ -0,0 +1,48 @@
+#ifndef _RIVE_AABB_TREE_HPP_
+#define _RIVE_AABB_TREE_HPP_
+
+#include "rive/math/aabb.hpp"
+#include "rive/span.hpp"
+#include <stdint.h>
+#include <vector>
+
+namespace rive
+{
+/// Bounding volume hierarchy over a fixed set of boxes, identified by their
+/// index in the span the tree was built from. Boxes can be moved with update
+/// and the tree refit to them without rebuilding it.
+class AABBTree
+{
+private:
+    struct Node
+    {
+        AABB bounds;
+        // Index of the box for leaves, -1 for internal nodes (whose left
+        // child immediately follows them).
+        int32_t box;
+        uint32_t right;
+    };
+
+    std::vector<AABB> m_Boxes;
+    std::vector<Node> m_Nodes;
+
+    uint32_t buildNode(uint32_t* indices, uint32_t count);
+
+public:
+    void build(Span<const AABB> boxes);
+
+    size_t size() const { return m_Boxes.size(); }
+    const AABB& box(size_t index) const { return m_Boxes[index]; }
+
+    /// Changes the box at index, call refit before querying again.
+    void update(size_t index, const AABB& box) { m_Boxes[index] = box; }
+
+    /// Recompute the bounds of every node from the current boxes.
+    void refit();
+
+    /// Replaces results with the indices of the boxes overlapping area (edges
+    /// touching counts as overlapping), in no particular order.
+    void query(const AABB& area, std::vector<uint32_t>& results) const;
+};
+} // namespace rive
+#endif
@@ -40,8 +40,9 @@ private:
 
     std::vector<Segment> m_segments;
     std::vector<Vec2D> m_points;
-    const float m_length;
-    const bool m_isClosed;
+    // Only changed when ContourMeasureIter recycles a measure.
+    float m_length;
+    bool m_isClosed;
 
     ContourMeasure(std::vector<Segment>&&, std::vector<Vec2D>&&, float length, bool isClosed);
 
@@ -87,7 +88,10 @@ class ContourMeasureIter
                        const Vec2D[],
                        uint32_t ptIndex,
                        float distance) const;
-    rcp<ContourMeasure> tryNext();
+    bool tryNext(std::vector<ContourMeasure::Segment>&,
+                 std::vector<Vec2D>&,
+                 float& length,
+                 bool& isClosed);
 
 public:
     // Tolerance is the max deviation of the curve from its approximating line
@@ -115,6 +119,12 @@ public:
     // that created it. It contains no back pointers to the Iter or to the path.
     //
     rcp<ContourMeasure> next();
+
+    // Like next(), but when reuse is the only reference to its measure that
+    // measure (and its storage) is recycled for the result instead of
+    // allocating a new one. Lets a caller that re-measures a path every frame
+    // do so without allocating.
+    rcp<ContourMeasure> next(rcp<ContourMeasure> reuse);
 };
 
 } // namespace rive
@@ -18,6 +18,8 @@ private:
     std::unique_ptr<ArtboardInstance> m_Instance; // may be null
     std::vector<NestedAnimation*> m_NestedAnimations;
 
+    Core* finishClone(Core* clone) const;
+
 public:
     NestedArtboard();
     ~NestedArtboard() override;
@@ -28,8 +30,14 @@ public:
 
     void nest(Artboard* artboard);
 
+    /// Reset the nested instance to the state of the artboard source nests
+    /// (source being the NestedArtboard this was cloned from) and restart
+    /// the nested animations.
+    void reset(const NestedArtboard* source);
+
     StatusCode import(ImportStack& importStack) override;
     Core* clone() const override;
+    Core* cloneInto(void* memory) const override;
     bool advance(float elapsedSeconds);
     void update(ComponentDirt value) override;
 
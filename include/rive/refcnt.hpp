@@ -51,6 +51,9 @@ public:
         }
     }
 
+    // true when the caller holds the only reference, so no one else can be using the object
+    bool unique() const { return m_refcnt.load(std::memory_order_acquire) == 1; }
+
     // not reliable in actual threaded scenarios, but useful (perhaps) for debugging
     int32_t debugging_refcnt() const { return m_refcnt.load(std::memory_order_relaxed); }
 
@@ -6,6 +6,7 @@
 #define _RIVE_COUNTER_HPP_
 
 #include "rive/rive_types.hpp"
+#include <atomic>
 
 namespace rive
 {
@@ -29,13 +30,15 @@ struct Counter
     };
 
     static constexpr int kNumTypes = Type::kLastType + 1;
-    static int counts[kNumTypes];
+    // Atomic so objects can be made and destroyed on multiple threads.
+    static std::atomic<int> counts[kNumTypes];
 
     static void update(Type ct, int delta)
     {
         assert(delta == 1 || delta == -1);
-        counts[ct] += delta;
-        assert(counts[ct] >= 0);
+        int count = counts[ct].fetch_add(delta, std::memory_order_relaxed) + delta;
+        assert(count >= 0);
+        (void)count;
     }
 };
 
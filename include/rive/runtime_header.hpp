@@ -83,6 +83,11 @@ public:
                 return false;
             }
         }
+        // The terminator itself may have been cut off.
+        if (reader.didOverflow())
+        {
+            return false;
+        }
 
         int currentInt = 0;
         int currentBit = 8;
@@ -28,6 +28,8 @@ public:
 
     Scene(Scene const& lhs) : m_ArtboardInstance(lhs.m_ArtboardInstance) {}
 
+    ArtboardInstance* artboardInstance() const { return m_ArtboardInstance; }
+
     float width() const;
     float height() const;
     AABB bounds() const { return {0, 0, this->width(), this->height()}; }
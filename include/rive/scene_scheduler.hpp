@@ -0,0 +1,72 @@
+#ifndef _RIVE_SCENE_SCHEDULER_HPP_
+#define _RIVE_SCENE_SCHEDULER_HPP_
+
+#include <cstddef>
+#include <stdint.h>
+#include <vector>
+
+namespace rive
+{
+class Scene;
+class WorkerPool;
+
+///
+/// Advances a batch of independent scenes across the threads of a
+/// WorkerPool. Add each scene with the time to advance it by, then call
+/// advanceAndApply once per tick.
+///
+/// Scenes that share an artboard instance always run on the same thread, in
+/// the order they were added, so no artboard instance is touched by two
+/// threads at once. Instances of the same artboard (and the File, artboards,
+/// animations and state machines they were made from) can be advanced
+/// concurrently, they're only read while advancing. Anything the scenes make
+/// while advancing (like render paths) comes from their artboard's factory on
+/// any of the threads, so it has to support being called concurrently.
+///
+class SceneScheduler
+{
+private:
+    struct Entry
+    {
+        Scene* scene;
+        float elapsedSeconds;
+    };
+    WorkerPool* m_Workers;
+    std::vector<Entry> m_Entries;
+    std::vector<uint8_t> m_NeedsDraw;
+    /// Entry indices sorted so the entries of each artboard instance are
+    /// next to each other (in the order they were added), and where each
+    /// instance's entries start.
+    std::vector<uint32_t> m_Order;
+    std::vector<uint32_t> m_GroupStarts;
+
+public:
+    /// @param workers null advances the scenes on the calling thread.
+    explicit SceneScheduler(WorkerPool* workers);
+
+    WorkerPool* workers() const { return m_Workers; }
+
+    /// Adds a scene to advance by elapsedSeconds in the next advanceAndApply.
+    /// The scene must stay alive until then.
+    void add(Scene* scene, float elapsedSeconds);
+
+    /// Changes how far the index-th scene added advances from now on.
+    void elapsedSeconds(size_t index, float value);
+
+    /// Removes the scenes added so far.
+    void clear();
+
+    size_t size() const { return m_Entries.size(); }
+
+    /// Advances and applies every scene added since the last clear, returns
+    /// once they all have. The scenes stay added for the next tick, grouping
+    /// them by artboard instance is only redone after adding more.
+    void advanceAndApply();
+
+    /// Whether the index-th scene added needs to be drawn, what its
+    /// advanceAndApply returned in the last advanceAndApply.
+    bool needsDraw(size_t index) const { return m_NeedsDraw[index] != 0; }
+};
+} // namespace rive
+
+#endif
@@ -15,6 +15,8 @@ private:
     ImageAsset* m_ImageAsset = nullptr;
     Mesh* m_Mesh = nullptr;
 
+    Core* finishClone(Core* clone) const;
+
 public:
     Mesh* mesh() const;
     void setMesh(Mesh* mesh);
@@ -24,6 +26,7 @@ public:
     StatusCode import(ImportStack& importStack) override;
     void assets(const std::vector<FileAsset*>& assets) override;
     Core* clone() const override;
+    Core* cloneInto(void* memory) const override;
 };
 } // namespace rive
 
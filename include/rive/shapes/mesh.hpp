@@ -22,6 +22,11 @@ protected:
     rcp<RenderBuffer> m_IndexRenderBuffer;
     rcp<RenderBuffer> m_VertexRenderBuffer;
     rcp<RenderBuffer> m_UVRenderBuffer;
+    // Kept between draws so rebuilding the vertex buffer doesn't allocate.
+    std::vector<float> m_VertexStorage;
+
+    Core* finishClone(Core* clone) const;
+    rcp<RenderBuffer> makeUVRenderBuffer(const RenderImage* renderImage) const;
 
 public:
     StatusCode onAddedDirty(CoreContext* context) override;
@@ -37,9 +42,11 @@ public:
     void updateVertexRenderBuffer(Renderer* renderer);
     void markSkinDirty() override;
     Core* clone() const override;
+    Core* cloneInto(void* memory) const override;
 
     /// Initialize the any buffers that will be shared amongst instances (the
-    /// instance are guaranteed to use the same RenderImage).
+    /// instance are guaranteed to use the same RenderImage). The UVs depend on
+    /// the image, if it hasn't been decoded yet they're made when first drawn.
     void initializeSharedBuffers(RenderImage* renderImage);
 
 #ifdef TESTING
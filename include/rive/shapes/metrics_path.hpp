@@ -15,6 +15,13 @@ class MetricsPath : public CommandPath
 private:
     RawPath m_RawPath; // temporary, until we build m_Contour
     rcp<ContourMeasure> m_Contour;
+    /// Whether m_Contour measures the current m_RawPath, reset keeps the
+    /// contour around so measuring the rebuilt path can recycle it.
+    bool m_HasContour = false;
+    /// Scratch paths kept so measuring and trimming every frame reuse their
+    /// storage: m_RawPath transformed for measuring, and the trimmed segment.
+    RawPath m_TransformedPath;
+    RawPath m_TrimmedPath;
     std::vector<MetricsPath*> m_Paths;
     Mat2D m_ComputedLengthTransform;
     float m_ComputedLength = 0;
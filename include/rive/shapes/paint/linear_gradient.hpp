@@ -15,6 +15,7 @@ class LinearGradient : public LinearGradientBase, public ShapePaintMutator
 {
 private:
     std::vector<GradientStop*> m_Stops;
+    std::vector<ColorInt> m_Storage;
     Node* m_ShapePaintContainer = nullptr;
 
 public:
@@ -26,6 +27,7 @@ public:
 
 protected:
     void buildDependencies() override;
+    void onResolved() override;
     void startXChanged() override;
     void startYChanged() override;
     void endXChanged() override;
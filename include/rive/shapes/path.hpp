@@ -42,7 +42,7 @@ protected:
 public:
     Shape* shape() const { return m_Shape; }
     StatusCode onAddedClean(CoreContext* context) override;
-    void buildDependencies() override;
+    void onResolved() override;
     virtual const Mat2D& pathTransform() const;
     CommandPath* commandPath() const { return m_CommandPath.get(); }
     void update(ComponentDirt value) override;
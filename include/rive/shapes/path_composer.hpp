@@ -12,6 +12,7 @@ private:
     Shape* m_Shape;
     std::unique_ptr<CommandPath> m_LocalPath;
     std::unique_ptr<CommandPath> m_WorldPath;
+    uint32_t m_Version = 0;
 
 public:
     PathComposer(Shape* shape);
@@ -21,6 +22,10 @@ public:
 
     CommandPath* localPath() const { return m_LocalPath.get(); }
     CommandPath* worldPath() const { return m_WorldPath.get(); }
+
+    /// Changes every time the shape's paths are recomposed, which happens
+    /// after any of them (or their transforms) change.
+    uint32_t version() const { return m_Version; }
 };
 } // namespace rive
 #endif
@@ -25,6 +25,7 @@ private:
 public:
     Shape();
     void buildDependencies() override;
+    void onResolved() override;
     void addPath(Path* path);
     std::vector<Path*>& paths() { return m_Paths; }
 
@@ -35,6 +36,10 @@ public:
     Core* hitTest(HitInfo*, const Mat2D&) override;
     bool hitTest(const IAABB& area) const;
 
+    /// Bounds of the control points of the shape's paths in world space,
+    /// which contain anything hitTest(area) can hit.
+    AABB computeWorldBounds() const;
+
     const PathComposer* pathComposer() const { return &m_PathComposer; }
     PathComposer* pathComposer() { return &m_PathComposer; }
 
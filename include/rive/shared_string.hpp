@@ -0,0 +1,43 @@
+#ifndef _RIVE_SHARED_STRING_HPP_
+#define _RIVE_SHARED_STRING_HPP_
+
+#include "rive/refcnt.hpp"
+#include <string>
+
+namespace rive
+{
+/// Immutable string whose characters are shared by its copies, so copying
+/// an object (like instancing an artboard does) doesn't copy its strings.
+/// Assigning a new value detaches it from the copies.
+class SharedString
+{
+private:
+    class Storage : public RefCnt<Storage>
+    {
+    public:
+        explicit Storage(std::string&& value) : value(std::move(value)) {}
+        const std::string value;
+    };
+    rcp<Storage> m_Storage;
+
+    static const std::string& empty()
+    {
+        static const std::string value;
+        return value;
+    }
+
+public:
+    SharedString() = default;
+    SharedString(const char* value) : SharedString(std::string(value)) {}
+    SharedString(std::string value) :
+        m_Storage(value.empty() ? nullptr : new Storage(std::move(value)))
+    {}
+
+    const std::string& str() const { return m_Storage == nullptr ? empty() : m_Storage->value; }
+    operator const std::string&() const { return str(); }
+
+    bool operator==(const std::string& other) const { return str() == other; }
+    bool operator!=(const std::string& other) const { return str() != other; }
+};
+} // namespace rive
+#endif
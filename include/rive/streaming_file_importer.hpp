@@ -0,0 +1,63 @@
+#ifndef _RIVE_STREAMING_FILE_IMPORTER_HPP_
+#define _RIVE_STREAMING_FILE_IMPORTER_HPP_
+
+#include "rive/file.hpp"
+#include "rive/span.hpp"
+#include <memory>
+#include <vector>
+
+namespace rive
+{
+class Core;
+class ImportStack;
+
+///
+/// Imports a Rive file from chunks of its bytes as they arrive, so artboards
+/// can be used before the rest of the file has been received.
+///
+class StreamingFileImporter
+{
+private:
+    Factory* m_Factory;
+    FileAssetResolver* m_AssetResolver;
+    ImportResult m_Result = ImportResult::success;
+
+    /// Bytes received but not imported yet.
+    std::vector<uint8_t> m_Pending;
+    /// How much of m_Pending has been read, when there's an artboard being
+    /// read its objects start at the beginning of m_Pending.
+    size_t m_Read = 0;
+
+    std::unique_ptr<File> m_File;
+    std::unique_ptr<ImportStack> m_ImportStack;
+    /// The artboard whose objects are being received.
+    Core* m_Artboard = nullptr;
+    uint32_t m_ArtboardObjectCount = 0;
+
+    ImportResult importPending(bool finished);
+    ImportResult completeArtboard();
+
+public:
+    StreamingFileImporter(Factory*, FileAssetResolver* assetResolver = nullptr);
+    ~StreamingFileImporter();
+
+    /// Imports what the bytes received so far allow.
+    /// @returns success as long as the bytes are valid so far, otherwise the
+    /// error (after which any more chunks are ignored).
+    ImportResult append(Span<const uint8_t> chunk);
+
+    /// The file as it's been imported so far, null until its header has been
+    /// received. Artboards are added to it once all of their objects have been
+    /// received, assets as soon as they are (in-band contents are decoded as
+    /// they arrive). Nested artboards referencing artboards later in the file
+    /// are nested by finish.
+    File* file() const { return m_File.get(); }
+
+    /// Call once all of the file's bytes have been appended.
+    /// @param result is an optional status result.
+    /// @returns the imported file, or null if the bytes were malformed or
+    /// incomplete.
+    std::unique_ptr<File> finish(ImportResult* result = nullptr);
+};
+} // namespace rive
+#endif
@@ -0,0 +1,91 @@
+#ifndef _RIVE_WORKER_POOL_HPP_
+#define _RIVE_WORKER_POOL_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <stdint.h>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace rive
+{
+/// A fixed set of threads that split up the work handed to parallelFor, and
+/// run tasks submitted to them in the background. The thread calling
+/// parallelFor works alongside them, so a pool with a single thread runs
+/// everything on the caller.
+class WorkerPool
+{
+public:
+    typedef void (*Work)(void* context, size_t index);
+    typedef void (*Task)(void* context);
+
+    /// @param threadCount how many threads work on a parallelFor, including
+    /// the one calling it. 0 uses one per hardware thread.
+    explicit WorkerPool(size_t threadCount = 0);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    size_t threadCount() const { return m_Threads.size() + 1; }
+
+    /// Calls work(context, index) for every index in [0, count), returns once
+    /// they've all returned. Indices are handed out one at a time to whichever
+    /// thread is free, in no particular order. Calls made from within work
+    /// (on any pool) run serially on the calling thread.
+    void parallelFor(size_t count, Work work, void* context);
+
+    template <typename Fn> void parallelFor(size_t count, Fn&& fn)
+    {
+        typedef typename std::remove_reference<Fn>::type Function;
+        parallelFor(
+            count,
+            [](void* context, size_t index) { (*static_cast<Function*>(context))(index); },
+            (void*)&fn);
+    }
+
+    /// Queues task(context) to run on one of the pool's threads, or runs it
+    /// right away when there's only the calling thread. Threads that are free
+    /// pick up queued tasks in the order they were submitted, a parallelFor
+    /// takes priority over them. Tasks that are still queued when the pool is
+    /// destroyed run before it's done.
+    void submit(Task task, void* context);
+
+    template <typename Fn> void submit(Fn&& fn)
+    {
+        typedef typename std::decay<Fn>::type Function;
+        submit(
+            [](void* context) {
+                auto function = static_cast<Function*>(context);
+                (*function)();
+                delete function;
+            },
+            new Function(std::forward<Fn>(fn)));
+    }
+
+private:
+    void workerMain();
+    void runWork(Work work, void* context, size_t count);
+
+    std::vector<std::thread> m_Threads;
+    // Held for the whole of a parallelFor so only one runs at a time.
+    std::mutex m_ParallelForMutex;
+
+    std::mutex m_Mutex;
+    std::condition_variable m_WorkReady;
+    std::condition_variable m_WorkDone;
+    Work m_Work = nullptr;
+    void* m_Context = nullptr;
+    size_t m_Count = 0;
+    uint64_t m_Generation = 0;
+    size_t m_Busy = 0;
+    bool m_Exiting = false;
+    std::deque<std::pair<Task, void*>> m_Tasks;
+    std::atomic<size_t> m_NextIndex{0};
+};
+} // namespace rive
+#endif
@@ -38,6 +38,8 @@ class NoOpFactory : public Factory
     std::unique_ptr<RenderPaint> makeRenderPaint() override;
 
     std::unique_ptr<RenderImage> decodeImage(Span<const uint8_t>) override;
+
+    bool canDecodeConcurrently() const override { return true; }
 };
 } // namespace rive
 #endif
@@ -3,6 +3,7 @@
  */
 
 #include "rive/artboard.hpp"
+#include "rive/baked_file.hpp"
 #include "rive/file.hpp"
 #include "rive/animation/linear_animation_instance.hpp"
 #include "rive/animation/state_machine_instance.hpp"
@@ -135,30 +136,69 @@ static void dump(JSoner& js, rive::File* file)
     js.pop();
 }
 
-static std::unique_ptr<rive::File> open_file(const char name[])
+static rive::NoOpFactory gFactory;
+
+static bool read_bytes(const char name[], std::vector<uint8_t>& bytes)
 {
     FILE* f = fopen(name, "rb");
     if (!f)
     {
-        return nullptr;
+        return false;
     }
 
     fseek(f, 0, SEEK_END);
     auto length = ftell(f);
     fseek(f, 0, SEEK_SET);
 
-    std::vector<uint8_t> bytes(length);
+    bytes.resize(length);
 
-    if (fread(bytes.data(), 1, length, f) != length)
+    bool read = fread(bytes.data(), 1, length, f) == length;
+    fclose(f);
+    if (!read)
     {
         printf("Failed to read file into bytes array\n");
-        return nullptr;
     }
+    return read;
+}
 
-    static rive::NoOpFactory gFactory;
+static std::unique_ptr<rive::File> open_file(const char name[])
+{
+    std::vector<uint8_t> bytes;
+    if (!read_bytes(name, bytes))
+    {
+        return nullptr;
+    }
     return rive::File::import(bytes, &gFactory);
 }
 
+static int bake_file(const char name[], const char output[])
+{
+    std::vector<uint8_t> bytes;
+    if (!read_bytes(name, bytes))
+    {
+        printf("Can't open %s\n", name);
+        return 1;
+    }
+    auto baked = rive::BakedFile::bake(bytes, &gFactory);
+    if (baked.empty())
+    {
+        printf("Can't bake %s\n", name);
+        return 1;
+    }
+    FILE* f = fopen(output, "wb");
+    bool written = f && fwrite(baked.data(), 1, baked.size(), f) == baked.size();
+    if (f)
+    {
+        fclose(f);
+    }
+    if (!written)
+    {
+        printf("Can't write %s\n", output);
+        return 1;
+    }
+    return 0;
+}
+
 static bool is_arg(const char arg[], const char target[], const char alt[] = nullptr)
 {
     return !strcmp(arg, target) || (arg && !strcmp(arg, alt));
@@ -167,6 +207,7 @@ static bool is_arg(const char arg[], const char target[], const char alt[] = nul
 int main(int argc, const char* argv[])
 {
     const char* filename = nullptr;
+    const char* bakeFilename = nullptr;
 
     for (int i = 1; i < argc; ++i)
     {
@@ -175,6 +216,11 @@ int main(int argc, const char* argv[])
             filename = argv[++i];
             continue;
         }
+        if (is_arg(argv[i], "--bake", "-b"))
+        {
+            bakeFilename = argv[++i];
+            continue;
+        }
         printf("Unrecognized argument %s\n", argv[i]);
         return 1;
     }
@@ -185,6 +231,11 @@ int main(int argc, const char* argv[])
         return 1;
     }
 
+    if (bakeFilename)
+    {
+        return bake_file(filename, bakeFilename);
+    }
+
     auto file = open_file(filename);
     if (!file)
     {
@@ -26,4 +26,10 @@ void AnimationStateInstance::advance(float seconds, Span<SMIInput*>)
 
 void AnimationStateInstance::apply(float mix) { m_AnimationInstance.apply(mix); }
 
-bool AnimationStateInstance::keepGoing() const { return m_KeepGoing; }
\ No newline at end of file
+bool AnimationStateInstance::keepGoing() const { return m_KeepGoing; }
+
+void AnimationStateInstance::reset()
+{
+    m_AnimationInstance.reset();
+    m_KeepGoing = true;
+}
\ No newline at end of file
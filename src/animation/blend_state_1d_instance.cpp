@@ -39,6 +39,13 @@ int BlendState1DInstance::animationIndex(float value)
     return idx;
 }
 
+void BlendState1DInstance::reset()
+{
+    BlendStateInstance<BlendState1D, BlendAnimation1D>::reset();
+    m_From = nullptr;
+    m_To = nullptr;
+}
+
 void BlendState1DInstance::advance(float seconds, Span<SMIInput*> inputs)
 {
     BlendStateInstance<BlendState1D, BlendAnimation1D>::advance(seconds, inputs);
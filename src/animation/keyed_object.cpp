@@ -55,6 +55,19 @@ void KeyedObject::apply(Artboard* artboard, float time, float mix)
     }
 }
 
+void KeyedObject::bind(Artboard* artboard, std::vector<KeyedPropertyBinding>& bindings) const
+{
+    Core* object = artboard->resolve(objectId());
+    if (object == nullptr)
+    {
+        return;
+    }
+    for (auto& property : m_KeyedProperties)
+    {
+        bindings.push_back({object, property.get(), 0});
+    }
+}
+
 StatusCode KeyedObject::import(ImportStack& importStack)
 {
     auto importer = importStack.latest<LinearAnimationImporter>(LinearAnimationBase::typeKey);
@@ -1,11 +1,82 @@
 #include "rive/animation/keyed_property.hpp"
+#include "rive/animation/cubic_interpolator.hpp"
 #include "rive/animation/keyed_object.hpp"
-#include "rive/animation/keyframe.hpp"
+#include "rive/animation/keyframe_bool.hpp"
+#include "rive/animation/keyframe_color.hpp"
+#include "rive/animation/keyframe_double.hpp"
+#include "rive/animation/keyframe_id.hpp"
 #include "rive/importers/import_stack.hpp"
 #include "rive/importers/keyed_object_importer.hpp"
+#include "rive/math/math_types.hpp"
+#include "rive/shapes/paint/color.hpp"
 
 using namespace rive;
 
+namespace
+{
+// Type specialized keyframe evaluation, each provides how to decode the
+// compacted value bits, how to interpolate between two values, and how to
+// apply a value to an object with mix.
+struct NumberKeyFrames
+{
+    using Value = float;
+    static Value decode(uint32_t bits) { return math::bit_cast<float>(bits); }
+    static Value interpolate(Value from, Value to, float f) { return from + (to - from) * f; }
+    static void apply(Core* object, const PropertyAccessors& accessors, Value value, float mix)
+    {
+        if (mix == 1.0f)
+        {
+            accessors.setDouble(object, value);
+        }
+        else
+        {
+            float mixi = 1.0f - mix;
+            accessors.setDouble(object, accessors.getDouble(object) * mixi + value * mix);
+        }
+    }
+};
+
+struct ColorKeyFrames
+{
+    using Value = ColorInt;
+    static Value decode(uint32_t bits) { return bits; }
+    static Value interpolate(Value from, Value to, float f) { return colorLerp(from, to, f); }
+    static void apply(Core* object, const PropertyAccessors& accessors, Value value, float mix)
+    {
+        if (mix == 1.0f)
+        {
+            accessors.setColor(object, value);
+        }
+        else
+        {
+            accessors.setColor(object, colorLerp(accessors.getColor(object), value, mix));
+        }
+    }
+};
+
+struct BoolKeyFrames
+{
+    using Value = bool;
+    static Value decode(uint32_t bits) { return bits != 0; }
+    static Value interpolate(Value from, Value to, float f) { return from; }
+    static void apply(Core* object, const PropertyAccessors& accessors, Value value, float mix)
+    {
+        accessors.setBool(object, value);
+    }
+};
+
+struct IdKeyFrames
+{
+    using Value = uint32_t;
+    static Value decode(uint32_t bits) { return bits; }
+    static Value interpolate(Value from, Value to, float f) { return from; }
+    static void apply(Core* object, const PropertyAccessors& accessors, Value value, float mix)
+    {
+        accessors.setUint(object, value);
+    }
+};
+} // namespace
+
 KeyedProperty::KeyedProperty() {}
 KeyedProperty::~KeyedProperty() {}
 
@@ -14,72 +85,219 @@ void KeyedProperty::addKeyFrame(std::unique_ptr<KeyFrame> keyframe)
     m_KeyFrames.push_back(std::move(keyframe));
 }
 
-void KeyedProperty::apply(Core* object, float seconds, float mix)
+void KeyedProperty::compactKeyFrames()
 {
-    assert(!m_KeyFrames.empty());
+    m_ValueType = KeyFrameValueType::none;
+    m_Seconds.clear();
+    m_Values.clear();
+    m_Interpolations.clear();
+    if (m_KeyFrames.empty())
+    {
+        return;
+    }
+
+    // All the keyframes of a property share a type (the one that matches the
+    // property), and the property has to be one this runtime can set.
+    auto typeKey = m_KeyFrames.front()->coreType();
+    switch (typeKey)
+    {
+        case KeyFrameDoubleBase::typeKey:
+            if (m_Accessors.setDouble != nullptr)
+            {
+                m_ValueType = KeyFrameValueType::number;
+            }
+            break;
+        case KeyFrameColorBase::typeKey:
+            if (m_Accessors.setColor != nullptr)
+            {
+                m_ValueType = KeyFrameValueType::color;
+            }
+            break;
+        case KeyFrameBoolBase::typeKey:
+            if (m_Accessors.setBool != nullptr)
+            {
+                m_ValueType = KeyFrameValueType::boolean;
+            }
+            break;
+        case KeyFrameIdBase::typeKey:
+            if (m_Accessors.setUint != nullptr)
+            {
+                m_ValueType = KeyFrameValueType::id;
+            }
+            break;
+    }
+    if (m_ValueType == KeyFrameValueType::none)
+    {
+        m_KeyFrames.clear();
+        return;
+    }
 
-    int idx = 0;
-    int mid = 0;
-    float closestSeconds = 0.0f;
+    m_Seconds.reserve(m_KeyFrames.size());
+    m_Values.reserve(m_KeyFrames.size());
+    m_Interpolations.reserve(m_KeyFrames.size());
+    for (auto& keyFrame : m_KeyFrames)
+    {
+        if (keyFrame->coreType() != typeKey)
+        {
+            continue;
+        }
+        uint32_t bits = 0;
+        switch (m_ValueType)
+        {
+            case KeyFrameValueType::number:
+                bits = math::bit_cast<uint32_t>(keyFrame->as<KeyFrameDouble>()->value());
+                break;
+            case KeyFrameValueType::color:
+                bits = keyFrame->as<KeyFrameColor>()->value();
+                break;
+            case KeyFrameValueType::boolean:
+                bits = keyFrame->as<KeyFrameBool>()->value() ? 1 : 0;
+                break;
+            case KeyFrameValueType::id:
+                bits = keyFrame->as<KeyFrameId>()->value();
+                break;
+            case KeyFrameValueType::none:
+                RIVE_UNREACHABLE;
+        }
+        m_Seconds.push_back(keyFrame->seconds());
+        m_Values.push_back(bits);
+        m_Interpolations.push_back({keyFrame->interpolator(), keyFrame->interpolationType() == 0});
+    }
+    m_KeyFrames.clear();
+}
+
+int KeyedProperty::closestFrameIndex(float seconds) const
+{
+    // Lower bound: keyframes at exactly seconds keep the search going left, so
+    // when several share a time the first is found (as the cursor walk does).
     int start = 0;
-    auto numKeyFrames = static_cast<int>(m_KeyFrames.size());
-    int end = numKeyFrames - 1;
+    int end = static_cast<int>(m_Seconds.size()) - 1;
     while (start <= end)
     {
-        mid = (start + end) >> 1;
-        closestSeconds = m_KeyFrames[mid]->seconds();
-        if (closestSeconds < seconds)
+        int mid = (start + end) >> 1;
+        if (m_Seconds[mid] < seconds)
         {
             start = mid + 1;
         }
-        else if (closestSeconds > seconds)
+        else
         {
             end = mid - 1;
         }
+    }
+    return start;
+}
+
+int KeyedProperty::closestFrameIndex(float seconds, int hint) const
+{
+    // How far we're willing to walk before we consider this a seek (or a
+    // loop) and fall back to the binary search.
+    const int maxSteps = 4;
+
+    auto numKeyFrames = static_cast<int>(m_Seconds.size());
+    if (hint < 0 || hint > numKeyFrames)
+    {
+        return closestFrameIndex(seconds);
+    }
+
+    int idx = hint;
+    for (int step = 0; step <= maxSteps; step++)
+    {
+        if (idx < numKeyFrames && m_Seconds[idx] < seconds)
+        {
+            idx++;
+        }
+        else if (idx > 0 && m_Seconds[idx - 1] >= seconds)
+        {
+            idx--;
+        }
         else
         {
-            idx = start = mid;
-            break;
+            return idx;
         }
-        idx = start;
     }
-    int pk = propertyKey();
+    return closestFrameIndex(seconds);
+}
 
+template <typename T>
+void KeyedProperty::applyKeyFrames(Core* object, int idx, float seconds, float mix)
+{
+    auto numKeyFrames = static_cast<int>(m_Seconds.size());
+    const uint32_t* values = m_Values.data();
     if (idx == 0)
     {
-        m_KeyFrames[0]->apply(object, pk, mix);
+        T::apply(object, m_Accessors, T::decode(values[0]), mix);
     }
-    else
+    else if (idx < numKeyFrames)
     {
-        if (idx < numKeyFrames)
+        int from = idx - 1;
+        if (seconds == m_Seconds[idx])
         {
-            KeyFrame* fromFrame = m_KeyFrames[idx - 1].get();
-            KeyFrame* toFrame = m_KeyFrames[idx].get();
-            if (seconds == toFrame->seconds())
-            {
-                toFrame->apply(object, pk, mix);
-            }
-            else
-            {
-                if (fromFrame->interpolationType() == 0)
-                {
-                    fromFrame->apply(object, pk, mix);
-                }
-                else
-                {
-                    fromFrame->applyInterpolation(object, pk, seconds, toFrame, mix);
-                }
-            }
+            T::apply(object, m_Accessors, T::decode(values[idx]), mix);
+        }
+        else if (m_Interpolations[from].hold)
+        {
+            T::apply(object, m_Accessors, T::decode(values[from]), mix);
         }
         else
         {
-            m_KeyFrames[idx - 1]->apply(object, pk, mix);
+            float f = (seconds - m_Seconds[from]) / (m_Seconds[idx] - m_Seconds[from]);
+            if (const CubicInterpolator* cubic = m_Interpolations[from].cubic)
+            {
+                f = cubic->transform(f);
+            }
+            T::apply(object,
+                     m_Accessors,
+                     T::interpolate(T::decode(values[from]), T::decode(values[idx]), f),
+                     mix);
         }
     }
+    else
+    {
+        T::apply(object, m_Accessors, T::decode(values[idx - 1]), mix);
+    }
+}
+
+void KeyedProperty::apply(Core* object, float seconds, float mix, int* cursor)
+{
+    if (m_ValueType == KeyFrameValueType::none)
+    {
+        // No keyframes or not a property this runtime knows how to set.
+        return;
+    }
+
+    int idx;
+    if (cursor != nullptr)
+    {
+        idx = *cursor = closestFrameIndex(seconds, *cursor);
+    }
+    else
+    {
+        idx = closestFrameIndex(seconds);
+    }
+
+    switch (m_ValueType)
+    {
+        case KeyFrameValueType::number:
+            applyKeyFrames<NumberKeyFrames>(object, idx, seconds, mix);
+            break;
+        case KeyFrameValueType::color:
+            applyKeyFrames<ColorKeyFrames>(object, idx, seconds, mix);
+            break;
+        case KeyFrameValueType::boolean:
+            applyKeyFrames<BoolKeyFrames>(object, idx, seconds, mix);
+            break;
+        case KeyFrameValueType::id:
+            applyKeyFrames<IdKeyFrames>(object, idx, seconds, mix);
+            break;
+        case KeyFrameValueType::none:
+            break;
+    }
 }
 
 StatusCode KeyedProperty::onAddedDirty(CoreContext* context)
 {
+    m_Accessors = PropertyAccessors::resolve(propertyKey());
+
     StatusCode code;
     for (auto& keyframe : m_KeyFrames)
     {
@@ -88,6 +306,10 @@ StatusCode KeyedProperty::onAddedDirty(CoreContext* context)
             return code;
         }
     }
+
+    // Keyframes have resolved their interpolators, we no longer need them
+    // as individual objects.
+    compactKeyFrames();
     return StatusCode::Ok;
 }
 
@@ -1,5 +1,6 @@
 #include "rive/animation/linear_animation.hpp"
 #include "rive/animation/keyed_object.hpp"
+#include "rive/animation/keyed_property.hpp"
 #include "rive/artboard.hpp"
 #include "rive/importers/artboard_importer.hpp"
 #include "rive/importers/import_stack.hpp"
@@ -58,6 +59,33 @@ void LinearAnimation::apply(Artboard* artboard, float time, float mix) const
     }
 }
 
+void LinearAnimation::bind(Artboard* artboard, std::vector<KeyedPropertyBinding>& bindings) const
+{
+    bindings.reserve(bindings.size() + keyedPropertyCount());
+    for (const auto& object : m_KeyedObjects)
+    {
+        object->bind(artboard, bindings);
+    }
+}
+
+void LinearAnimation::apply(std::vector<KeyedPropertyBinding>& bindings, float time, float mix)
+{
+    for (auto& binding : bindings)
+    {
+        binding.property->apply(binding.object, time, mix, &binding.cursor);
+    }
+}
+
+size_t LinearAnimation::keyedPropertyCount() const
+{
+    size_t count = 0;
+    for (const auto& object : m_KeyedObjects)
+    {
+        count += object->numKeyedProperties();
+    }
+    return count;
+}
+
 StatusCode LinearAnimation::import(ImportStack& importStack)
 {
     auto artboardImporter = importStack.latest<ArtboardImporter>(ArtboardBase::typeKey);
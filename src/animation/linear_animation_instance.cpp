@@ -17,6 +17,7 @@ LinearAnimationInstance::LinearAnimationInstance(const LinearAnimation* animatio
     m_SpilledTime(0.0f),
     m_Direction(1)
 {
+    m_Animation->bind(instance, m_Bindings);
     Counter::update(Counter::kLinearAnimationInstance, +1);
 }
 
@@ -29,7 +30,8 @@ LinearAnimationInstance::LinearAnimationInstance(LinearAnimationInstance const&
     m_SpilledTime(lhs.m_SpilledTime),
     m_Direction(lhs.m_Direction),
     m_DidLoop(lhs.m_DidLoop),
-    m_LoopValue(lhs.m_LoopValue)
+    m_LoopValue(lhs.m_LoopValue),
+    m_Bindings(lhs.m_Bindings)
 {
     Counter::update(Counter::kLinearAnimationInstance, +1);
 }
@@ -164,6 +166,19 @@ void LinearAnimationInstance::time(float value)
     m_Direction = 1;
 }
 
+void LinearAnimationInstance::reset()
+{
+    m_Time = m_Animation->enableWorkArea()
+                 ? (float)m_Animation->workStart() / m_Animation->fps()
+                 : 0;
+    m_TotalTime = 0.0f;
+    m_LastTotalTime = 0.0f;
+    m_SpilledTime = 0.0f;
+    m_Direction = 1;
+    m_DidLoop = false;
+    m_LoopValue = -1;
+}
+
 uint32_t LinearAnimationInstance::fps() const { return m_Animation->fps(); }
 
 uint32_t LinearAnimationInstance::duration() const { return m_Animation->duration(); }
@@ -4,6 +4,11 @@
 #include "rive/animation/state_machine_layer.hpp"
 #include "rive/animation/state_machine_input.hpp"
 #include "rive/animation/state_machine_listener.hpp"
+#include "rive/animation/state_transition.hpp"
+#include "rive/animation/transition_condition.hpp"
+#include "rive/animation/blend_state_1d.hpp"
+#include "rive/animation/blend_state_direct.hpp"
+#include "rive/animation/blend_animation_direct.hpp"
 
 using namespace rive;
 
@@ -62,9 +67,69 @@ StatusCode StateMachine::onAddedClean(CoreContext* context)
             return code;
         }
     }
+    buildInputDependents();
     return StatusCode::Ok;
 }
 
+void StateMachine::buildInputDependents()
+{
+    m_InputDependents.clear();
+    m_InputDependents.resize(m_Inputs.size());
+
+    auto addDependent = [this](uint32_t inputId, size_t layerIndex, const LayerState* state) {
+        if (inputId >= m_InputDependents.size())
+        {
+            return;
+        }
+        auto& dependents = m_InputDependents[inputId];
+        // States are visited one at a time so a repeat can only be the last
+        // one added.
+        if (!dependents.empty() && dependents.back().state == state)
+        {
+            return;
+        }
+        dependents.push_back({layerIndex, state});
+    };
+
+    for (size_t layerIndex = 0; layerIndex < m_Layers.size(); layerIndex++)
+    {
+        for (auto state : m_Layers[layerIndex]->m_States)
+        {
+            for (size_t i = 0, count = state->transitionCount(); i < count; i++)
+            {
+                auto transition = state->transition(i);
+                for (size_t j = 0, length = transition->conditionCount(); j < length; j++)
+                {
+                    addDependent(transition->condition(j)->inputId(), layerIndex, state);
+                }
+            }
+            if (state->is<BlendState1D>())
+            {
+                addDependent(state->as<BlendState1D>()->inputId(), layerIndex, state);
+            }
+            else if (state->is<BlendStateDirect>())
+            {
+                for (auto animation : state->as<BlendStateDirect>()->animations())
+                {
+                    addDependent(
+                        animation->as<BlendAnimationDirect>()->inputId(), layerIndex, state);
+                }
+            }
+        }
+    }
+}
+
+const std::vector<StateMachineInputDependent>&
+StateMachine::inputDependents(size_t inputIndex) const
+{
+    static const std::vector<StateMachineInputDependent> none;
+    if (inputIndex < m_InputDependents.size())
+    {
+        return m_InputDependents[inputIndex];
+    }
+    return none;
+}
+
 StatusCode StateMachine::import(ImportStack& importStack)
 {
     auto artboardImporter = importStack.latest<ArtboardImporter>(ArtboardBase::typeKey);
@@ -14,7 +14,7 @@ uint16_t SMIInput::inputCoreType() const { return m_Input->coreType(); }
 
 const std::string& SMIInput::name() const { return m_Input->name(); }
 
-void SMIInput::valueChanged() { m_MachineInstance->markNeedsAdvance(); }
+void SMIInput::valueChanged() { m_MachineInstance->inputChanged(this); }
 
 // bool
 
@@ -21,6 +21,7 @@
 #include "rive/nested_animation.hpp"
 #include "rive/animation/nested_state_machine.hpp"
 #include "rive/rive_counter.hpp"
+#include <algorithm>
 #include <unordered_map>
 
 using namespace rive;
@@ -37,6 +38,12 @@ private:
     StateInstance* m_CurrentState = nullptr;
     StateInstance* m_StateFrom = nullptr;
 
+    /// Instances of the layer's states, made the first time each state is
+    /// entered and reset when it's entered again. A state can't be re-entered
+    /// while it's still being mixed from (changes are blocked during a
+    /// transition) so one instance per state is enough.
+    std::unordered_map<const LayerState*, StateInstance*> m_StateInstances;
+
     // const LayerState* m_CurrentState = nullptr;
     // const LayerState* m_StateFrom = nullptr;
     const StateTransition* m_Transition = nullptr;
@@ -53,12 +60,20 @@ private:
     const LinearAnimation* m_HoldAnimation = nullptr;
     float m_HoldTime = 0.0f;
 
+    bool m_Asleep = false;
+    double m_AsleepSince = 0.0;
+    /// Time the layer slept through, advanced into the current state when
+    /// the layer next advances.
+    float m_SleptSeconds = 0.0f;
+
 public:
     ~StateMachineLayerInstance()
     {
         delete m_AnyStateInstance;
-        delete m_CurrentState;
-        delete m_StateFrom;
+        for (auto& pair : m_StateInstances)
+        {
+            delete pair.second;
+        }
     }
 
     void init(const StateMachineLayer* layer, ArtboardInstance* instance)
@@ -90,8 +105,15 @@ public:
 
         if (m_CurrentState != nullptr)
         {
+            if (m_SleptSeconds != 0.0f)
+            {
+                // Catch the settled state up (its animations' total time
+                // drives exit times) before advancing it for this frame.
+                m_CurrentState->advance(m_SleptSeconds, inputs);
+            }
             m_CurrentState->advance(seconds, inputs);
         }
+        m_SleptSeconds = 0.0f;
 
         updateMix(seconds);
 
@@ -150,11 +172,23 @@ public:
         {
             return false;
         }
-        m_CurrentState =
-            stateTo == nullptr ? nullptr : stateTo->makeInstance(m_ArtboardInstance).release();
+        m_CurrentState = stateTo == nullptr ? nullptr : stateInstance(stateTo);
         return true;
     }
 
+    StateInstance* stateInstance(const LayerState* state)
+    {
+        auto itr = m_StateInstances.find(state);
+        if (itr != m_StateInstances.end())
+        {
+            itr->second->reset();
+            return itr->second;
+        }
+        auto instance = state->makeInstance(m_ArtboardInstance).release();
+        m_StateInstances[state] = instance;
+        return instance;
+    }
+
     bool tryChangeState(StateInstance* stateFromInstance,
                         Span<SMIInput*> inputs,
                         bool ignoreTriggers)
@@ -174,11 +208,8 @@ public:
                 m_StateChangedOnAdvance = true;
                 // state actually has changed
                 m_Transition = transition;
-                if (m_StateFrom != m_AnyStateInstance)
-                {
-                    // Old state from is done.
-                    delete m_StateFrom;
-                }
+                // Old state from is done, it stays pooled for the next time
+                // its state is entered.
                 m_StateFrom = outState;
 
                 // If we had an exit time and wanted to pause on exit, make
@@ -243,6 +274,28 @@ public:
 
     bool stateChangedOnAdvance() const { return m_StateChangedOnAdvance; }
 
+    bool asleep() const { return m_Asleep; }
+
+    void sleep(double elapsedSeconds)
+    {
+        m_Asleep = true;
+        m_AsleepSince = elapsedSeconds;
+    }
+
+    void wake(double elapsedSeconds)
+    {
+        m_Asleep = false;
+        m_SleptSeconds = (float)(elapsedSeconds - m_AsleepSince);
+    }
+
+    /// Whether the layer needs to re-evaluate its transitions when an input
+    /// read by state changes.
+    bool readsInputsOf(const LayerState* state) const
+    {
+        return state == m_Layer->anyState() ||
+               (m_CurrentState != nullptr && m_CurrentState->state() == state);
+    }
+
     const LayerState* currentState()
     {
         return m_CurrentState == nullptr ? nullptr : m_CurrentState->state();
@@ -270,6 +323,8 @@ public:
     Shape* shape() const { return m_Shape; }
     HitShape(Shape* shape) : m_Shape(shape) {}
     bool isHovered = false;
+    /// The shape's PathComposer version when its bounds were last computed.
+    uint32_t pathVersion = 0;
     std::vector<const StateMachineListener*> listeners;
 };
 } // namespace rive
@@ -289,12 +344,26 @@ void StateMachineInstance::updateListeners(Vec2D position, ListenerType hitType)
                         position.y + hitRadius)
                        .round();
 
-    for (const auto& hitShape : m_HitShapes)
+    // Only shapes near the pointer can be hit, but the ones that were hovered
+    // still need to find out the pointer left them. Keep the shapes' order so
+    // listeners perform in the same order regardless of where the pointer is.
+    updateHitShapeBounds();
+    m_HitShapeTree.query(AABB(hitArea), m_HitCandidates);
+    m_HitCandidates.insert(
+        m_HitCandidates.end(), m_HoveredHitShapes.begin(), m_HoveredHitShapes.end());
+    std::sort(m_HitCandidates.begin(), m_HitCandidates.end());
+    m_HitCandidates.erase(std::unique(m_HitCandidates.begin(), m_HitCandidates.end()),
+                          m_HitCandidates.end());
+    m_HoveredHitShapes.clear();
+
+    for (auto index : m_HitCandidates)
     {
-
-        // TODO: quick reject.
-
+        const auto& hitShape = m_HitShapes[index];
         bool isOver = hitShape->shape()->hitTest(hitArea);
+        if (isOver)
+        {
+            m_HoveredHitShapes.push_back(index);
+        }
 
         bool hoverChange = hitShape->isHovered != isOver;
         hitShape->isHovered = isOver;
@@ -363,6 +432,26 @@ void StateMachineInstance::updateListeners(Vec2D position, ListenerType hitType)
     }
 }
 
+void StateMachineInstance::updateHitShapeBounds()
+{
+    bool changed = false;
+    for (size_t i = 0, count = m_HitShapes.size(); i < count; i++)
+    {
+        auto hitShape = m_HitShapes[i].get();
+        auto version = hitShape->shape()->pathComposer()->version();
+        if (hitShape->pathVersion != version)
+        {
+            hitShape->pathVersion = version;
+            m_HitShapeTree.update(i, hitShape->shape()->computeWorldBounds());
+            changed = true;
+        }
+    }
+    if (changed)
+    {
+        m_HitShapeTree.refit();
+    }
+}
+
 void StateMachineInstance::pointerMove(Vec2D position)
 {
     updateListeners(position, ListenerType::move);
@@ -406,9 +495,13 @@ StateMachineInstance::StateMachineInstance(const StateMachine* machine,
                 // Sanity check.
                 break;
         }
+        if (m_InputInstances[i] != nullptr)
+        {
+            m_InputInstances[i]->m_Index = i;
+        }
     }
 
-    m_LayerCount = machine->layerCount();
+    m_LayerCount = m_AwakeLayerCount = machine->layerCount();
     m_Layers = new StateMachineLayerInstance[m_LayerCount];
     for (size_t i = 0; i < m_LayerCount; i++)
     {
@@ -452,6 +545,15 @@ StateMachineInstance::StateMachineInstance(const StateMachine* machine,
         }
     }
 
+    std::vector<AABB> hitShapeBounds;
+    hitShapeBounds.reserve(m_HitShapes.size());
+    for (auto& hitShape : m_HitShapes)
+    {
+        hitShape->pathVersion = hitShape->shape()->pathComposer()->version();
+        hitShapeBounds.push_back(hitShape->shape()->computeWorldBounds());
+    }
+    m_HitShapeTree.build(hitShapeBounds);
+
     for (auto nestedArtboard : instance->nestedArtboards())
     {
         if (nestedArtboard->hasNestedStateMachines())
@@ -474,18 +576,38 @@ StateMachineInstance::~StateMachineInstance()
 
 bool StateMachineInstance::advance(float seconds)
 {
+    m_ElapsedSeconds += seconds;
     m_NeedsAdvance = false;
-    for (size_t i = 0; i < m_LayerCount; i++)
+    if (m_AwakeLayerCount != 0)
     {
-        if (m_Layers[i].advance(seconds, m_InputInstances))
+        for (size_t i = 0; i < m_LayerCount; i++)
         {
-            m_NeedsAdvance = true;
+            auto& layer = m_Layers[i];
+            if (layer.asleep())
+            {
+                // Still apply it so layers above it mix onto the same values
+                // they did before it settled.
+                layer.apply();
+            }
+            else if (layer.advance(seconds, m_InputInstances))
+            {
+                m_NeedsAdvance = true;
+            }
+            else if (!layer.stateChangedOnAdvance())
+            {
+                layer.sleep(m_ElapsedSeconds);
+                m_AwakeLayerCount--;
+            }
         }
     }
 
-    for (auto inst : m_InputInstances)
+    if (m_InputChanged)
     {
-        inst->advanced();
+        m_InputChanged = false;
+        for (auto inst : m_InputInstances)
+        {
+            inst->advanced();
+        }
     }
 
     return m_NeedsAdvance;
@@ -499,6 +621,21 @@ bool StateMachineInstance::advanceAndApply(float seconds)
 }
 
 void StateMachineInstance::markNeedsAdvance() { m_NeedsAdvance = true; }
+
+void StateMachineInstance::inputChanged(const SMIInput* input)
+{
+    m_InputChanged = true;
+    markNeedsAdvance();
+    for (auto& dependent : m_Machine->inputDependents(input->m_Index))
+    {
+        auto& layer = m_Layers[dependent.layerIndex];
+        if (layer.asleep() && layer.readsInputsOf(dependent.state))
+        {
+            layer.wake(m_ElapsedSeconds);
+            m_AwakeLayerCount++;
+        }
+    }
+}
 bool StateMachineInstance::needsAdvance() const { return m_NeedsAdvance; }
 
 std::string StateMachineInstance::name() const { return m_Machine->name(); }
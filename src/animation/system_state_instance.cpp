@@ -8,4 +8,5 @@ SystemStateInstance::SystemStateInstance(const LayerState* layerState, ArtboardI
 void SystemStateInstance::advance(float seconds, Span<SMIInput*>) {}
 void SystemStateInstance::apply(float mix) {}
 
-bool SystemStateInstance::keepGoing() const { return false; }
\ No newline at end of file
+bool SystemStateInstance::keepGoing() const { return false; }
+void SystemStateInstance::reset() {}
\ No newline at end of file
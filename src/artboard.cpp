@@ -1,5 +1,6 @@
 #include "rive/artboard.hpp"
 #include "rive/backboard.hpp"
+#include "rive/constraints/ik_constraint.hpp"
 #include "rive/animation/animation.hpp"
 #include "rive/animation/linear_animation_instance.hpp"
 #include "rive/dependency_sorter.hpp"
@@ -16,9 +17,12 @@
 #include "rive/importers/backboard_importer.hpp"
 #include "rive/nested_artboard.hpp"
 #include "rive/animation/state_machine_instance.hpp"
+#include "rive/shapes/shape.hpp"
+#include "rive/worker_pool.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <stack>
-#include <unordered_map>
 
 using namespace rive;
 
@@ -31,7 +35,15 @@ Artboard::~Artboard()
         {
             continue;
         }
-        delete object;
+        if (inObjectArena(object))
+        {
+            // The arena owns the memory, it gets freed with the artboard.
+            object->~Core();
+        }
+        else
+        {
+            delete object;
+        }
     }
 
     // Instances reference back to the original artboard's animations and state
@@ -61,7 +73,7 @@ StatusCode Artboard::initialize()
 {
     StatusCode code;
 
-    // these will be re-built in update() -- are they needed here?
+    // these are rebuilt in place by update() whenever the artboard resizes
     m_BackgroundPath = factory()->makeEmptyRenderPath();
     m_ClipPath = factory()->makeEmptyRenderPath();
 
@@ -105,17 +117,42 @@ StatusCode Artboard::initialize()
         }
     }
 
-    // Store a map of the drawRules to make it easier to lookup the matching
-    // rule for a transform component.
-    std::unordered_map<Core*, DrawRules*> componentDrawRules;
+    // A source artboard only has a template this early when it was baked,
+    // which is only trusted once it's been checked against the objects.
+    bool baked = !isInstance() && m_Template != nullptr;
+    if (baked && !acceptsTemplate(*m_Template))
+    {
+        fprintf(stderr, "Artboard::initialize - baked template doesn't match the artboard\n");
+        m_Template = nullptr;
+        baked = false;
+    }
+
+    // Instances share their source's template, which already has the child
+    // index and (usually) the dependency wiring.
+    bool wireFromTemplate = m_Template != nullptr && m_Template->hasWiring;
+    rcp<Template> capture;
+    if (m_Template == nullptr)
+    {
+        // Parents have resolved, index the hierarchy so passes that need to
+        // find children (or everything under a component) don't scan all
+        // objects.
+        capture = rcp<Template>(new Template());
+        buildChildIndex(*capture);
+        m_Template = capture;
+    }
+
+    // Id of the draw rules attached to each component (by id), 0 for none
+    // (that's the artboard, which is never a rule).
+    std::vector<uint32_t> componentDrawRules(wireFromTemplate ? 0 : m_Objects.size(), 0);
 
     // onAddedClean is called when all individually referenced components have
     // been found and so components can look at other components' references and
     // assume that they have resolved too. This is where the whole hierarchy is
     // linked up and we can traverse it to find other references (my parent's
     // parent should be type X can be checked now).
-    for (auto object : m_Objects)
+    for (uint32_t id = 0, count = (uint32_t)m_Objects.size(); id < count; id++)
     {
+        auto object = m_Objects[id];
         if (object == nullptr)
         {
             continue;
@@ -128,11 +165,15 @@ StatusCode Artboard::initialize()
         {
             case DrawRulesBase::typeKey:
             {
+                if (wireFromTemplate)
+                {
+                    break;
+                }
                 DrawRules* rules = reinterpret_cast<DrawRules*>(object);
                 Core* component = resolve(rules->parentId());
                 if (component != nullptr)
                 {
-                    componentDrawRules[component] = rules;
+                    componentDrawRules[rules->parentId()] = id;
                 }
                 else
                 {
@@ -168,10 +209,43 @@ StatusCode Artboard::initialize()
         }
     }
 
+    for (auto object : m_Objects)
+    {
+        if (object != nullptr && object->is<Component>())
+        {
+            object->as<Component>()->onResolved();
+        }
+    }
+
+    if (wireFromTemplate)
+    {
+        // The graph comes from the template, no need to build it again.
+        applyTemplate();
+        return StatusCode::Ok;
+    }
+
+    // Flatten the draw rules down the hierarchy, each component gets the
+    // rules of the closest of itself and its ancestors that has some.
+    std::vector<uint32_t> stack = {0};
+    while (!stack.empty())
+    {
+        auto id = stack.back();
+        stack.pop_back();
+        for (auto childId : childIds(id))
+        {
+            if (componentDrawRules[childId] == 0)
+            {
+                componentDrawRules[childId] = componentDrawRules[id];
+            }
+            stack.push_back(childId);
+        }
+    }
+
     // Multi-level references have been built up, now we can
     // actually mark what's dependent on what.
-    for (auto object : m_Objects)
+    for (uint32_t id = 0, count = (uint32_t)m_Objects.size(); id < count; id++)
     {
+        auto object = m_Objects[id];
         if (object == nullptr)
         {
             continue;
@@ -185,15 +259,10 @@ StatusCode Artboard::initialize()
             Drawable* drawable = object->as<Drawable>();
             m_Drawables.push_back(drawable);
 
-            for (ContainerComponent* parent = drawable; parent != nullptr;
-                 parent = parent->parent())
+            auto rulesId = componentDrawRules[id];
+            if (rulesId != 0)
             {
-                auto itr = componentDrawRules.find(parent);
-                if (itr != componentDrawRules.end())
-                {
-                    drawable->flattenedDrawRules = itr->second;
-                    break;
-                }
+                drawable->flattenedDrawRules = m_Objects[rulesId]->as<DrawRules>();
             }
         }
     }
@@ -214,21 +283,20 @@ StatusCode Artboard::initialize()
             DrawTarget* target = object->as<DrawTarget>();
             root.addDependent(target);
 
-            auto dependentRules = target->drawable()->flattenedDrawRules;
-            if (dependentRules != nullptr)
+            auto rulesId = target->drawable() == nullptr
+                               ? 0
+                               : componentDrawRules[target->drawableId()];
+            if (rulesId != 0)
             {
                 // Because we don't store targets on rules, we need
                 // to find the targets that belong to this rule
                 // here.
-                for (auto object : m_Objects)
+                for (auto childId : childIds(rulesId))
                 {
-                    if (object != nullptr && object->is<DrawTarget>())
+                    auto child = m_Objects[childId];
+                    if (child->is<DrawTarget>())
                     {
-                        DrawTarget* dependentTarget = object->as<DrawTarget>();
-                        if (dependentTarget->parent() == dependentRules)
-                        {
-                            dependentTarget->addDependent(target);
-                        }
+                        child->as<DrawTarget>()->addDependent(target);
                     }
                 }
             }
@@ -244,9 +312,287 @@ StatusCode Artboard::initialize()
         m_DrawTargets.push_back(reinterpret_cast<DrawTarget*>(*itr++));
     }
 
+    if (capture != nullptr)
+    {
+        captureTemplate(*capture);
+    }
+
     return StatusCode::Ok;
 }
 
+bool Artboard::acceptsTemplate(const Template& tmpl) const
+{
+    // Offsets must be ascending and end at the size of what they index.
+    auto validOffsets = [](const std::vector<uint32_t>& offsets, size_t size, size_t count) {
+        if (offsets.size() != size + 1 || offsets[0] != 0 || offsets[size] != count)
+        {
+            return false;
+        }
+        for (size_t i = 0; i < size; i++)
+        {
+            if (offsets[i] > offsets[i + 1])
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto count = (uint32_t)m_Objects.size();
+    if (!validOffsets(tmpl.childOffsets, count, tmpl.childIds.size()))
+    {
+        return false;
+    }
+    for (uint32_t id = 0; id < count; id++)
+    {
+        for (auto i = tmpl.childOffsets[id]; i < tmpl.childOffsets[id + 1]; i++)
+        {
+            auto childId = tmpl.childIds[i];
+            auto child = childId < count ? m_Objects[childId] : nullptr;
+            if (child == nullptr || !child->is<Component>() ||
+                child->as<Component>()->parentId() != id)
+            {
+                return false;
+            }
+        }
+    }
+    if (!tmpl.hasWiring)
+    {
+        return true;
+    }
+
+    auto refCount = count * 2;
+    auto isRef = [&](uint32_t ref) { return ref < refCount && hasTemplateRef(ref); };
+    auto isObject = [&](uint32_t id, uint16_t typeKey) {
+        return id < count && m_Objects[id] != nullptr && m_Objects[id]->isTypeOf(typeKey);
+    };
+    if (!validOffsets(tmpl.dependentOffsets, refCount, tmpl.dependents.size()) ||
+        tmpl.drawableRules.size() != tmpl.drawables.size())
+    {
+        return false;
+    }
+    for (uint32_t ref = 0; ref < refCount; ref++)
+    {
+        if (tmpl.dependentOffsets[ref] != tmpl.dependentOffsets[ref + 1] && !isRef(ref))
+        {
+            return false;
+        }
+    }
+    for (auto ref : tmpl.dependents)
+    {
+        if (!isRef(ref))
+        {
+            return false;
+        }
+    }
+    for (auto ref : tmpl.dependencyOrder)
+    {
+        if (!isRef(ref))
+        {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < tmpl.drawables.size(); i++)
+    {
+        if (!isObject(tmpl.drawables[i], DrawableBase::typeKey) ||
+            (tmpl.drawableRules[i] != 0 &&
+             !isObject(tmpl.drawableRules[i], DrawRulesBase::typeKey)))
+        {
+            return false;
+        }
+    }
+    for (auto id : tmpl.drawTargets)
+    {
+        if (!isObject(id, DrawTargetBase::typeKey))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Artboard::hasTemplateRef(uint32_t ref) const
+{
+    auto count = (uint32_t)m_Objects.size();
+    auto object = m_Objects[ref < count ? ref : ref - count];
+    return object != nullptr && (ref < count ? object->is<Component>() : object->is<Shape>());
+}
+
+Component* Artboard::templateComponent(uint32_t ref) const
+{
+    auto count = (uint32_t)m_Objects.size();
+    if (ref < count)
+    {
+        return m_Objects[ref]->as<Component>();
+    }
+    return m_Objects[ref - count]->as<Shape>()->pathComposer();
+}
+
+void Artboard::captureTemplate(Template& tmpl)
+{
+    auto refCount = (uint32_t)m_Objects.size() * 2;
+
+    // Components don't know their id, borrow their graph order to look refs
+    // up. Verify them too, as something that isn't one of our objects could
+    // be in the graph.
+    std::vector<unsigned int> graphOrders(refCount);
+    for (uint32_t ref = 0; ref < refCount; ref++)
+    {
+        if (hasTemplateRef(ref))
+        {
+            auto component = templateComponent(ref);
+            graphOrders[ref] = component->m_GraphOrder;
+            component->m_GraphOrder = ref;
+        }
+    }
+    auto refOf = [&](Component* component, uint32_t& ref) {
+        ref = component->m_GraphOrder;
+        return ref < refCount && hasTemplateRef(ref) && templateComponent(ref) == component;
+    };
+
+    auto capture = [&]() {
+        tmpl.dependentOffsets.assign(refCount + 1, 0);
+        tmpl.dependents.clear();
+        for (uint32_t ref = 0; ref < refCount; ref++)
+        {
+            if (hasTemplateRef(ref))
+            {
+                for (auto dependent : templateComponent(ref)->m_Dependents)
+                {
+                    uint32_t dependentRef;
+                    if (!refOf(dependent, dependentRef))
+                    {
+                        return false;
+                    }
+                    tmpl.dependents.push_back(dependentRef);
+                }
+            }
+            tmpl.dependentOffsets[ref + 1] = (uint32_t)tmpl.dependents.size();
+        }
+
+        tmpl.dependencyOrder.resize(m_DependencyOrder.size());
+        for (size_t i = 0; i < m_DependencyOrder.size(); i++)
+        {
+            if (!refOf(m_DependencyOrder[i], tmpl.dependencyOrder[i]))
+            {
+                return false;
+            }
+        }
+
+        tmpl.drawables.resize(m_Drawables.size());
+        tmpl.drawableRules.assign(m_Drawables.size(), 0);
+        for (size_t i = 0; i < m_Drawables.size(); i++)
+        {
+            auto drawable = m_Drawables[i];
+            if (!refOf(drawable, tmpl.drawables[i]) ||
+                (drawable->flattenedDrawRules != nullptr &&
+                 !refOf(drawable->flattenedDrawRules, tmpl.drawableRules[i])))
+            {
+                return false;
+            }
+        }
+
+        tmpl.drawTargets.resize(m_DrawTargets.size());
+        for (size_t i = 0; i < m_DrawTargets.size(); i++)
+        {
+            if (!refOf(m_DrawTargets[i], tmpl.drawTargets[i]))
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+    tmpl.hasWiring = capture();
+
+    for (uint32_t ref = 0; ref < refCount; ref++)
+    {
+        if (hasTemplateRef(ref))
+        {
+            templateComponent(ref)->m_GraphOrder = graphOrders[ref];
+        }
+    }
+}
+
+bool Artboard::resetInstance(ArtboardInstance* instance) const
+{
+    if (instance == nullptr || m_Template == nullptr || instance->m_Template != m_Template)
+    {
+        return false;
+    }
+
+    // Objects are cloned in id order (the artboard itself first), so every
+    // object of the instance sits at its source's id. Properties go back
+    // through their change callbacks and every component is marked filthy,
+    // so whatever was computed from changed values is recomputed.
+    for (size_t id = 0; id < m_Objects.size(); id++)
+    {
+        auto object = instance->m_Objects[id];
+        if (object == nullptr)
+        {
+            continue;
+        }
+        object->assignProperties(m_Objects[id]);
+        if (object->is<Component>())
+        {
+            object->as<Component>()->addDirt(ComponentDirt::Filthy);
+        }
+    }
+    instance->m_FrameOrigin = m_FrameOrigin;
+
+    // Nested artboards are collected in id order for both.
+    for (size_t i = 0;
+         i < instance->m_NestedArtboards.size() && i < m_NestedArtboards.size();
+         i++)
+    {
+        instance->m_NestedArtboards[i]->reset(m_NestedArtboards[i]);
+    }
+    instance->addDirt(ComponentDirt::DrawOrder);
+    return true;
+}
+
+void Artboard::applyTemplate()
+{
+    const Template& tmpl = *m_Template;
+    auto refCount = (uint32_t)tmpl.dependentOffsets.size() - 1;
+    for (uint32_t ref = 0; ref < refCount; ref++)
+    {
+        auto start = tmpl.dependentOffsets[ref];
+        auto end = tmpl.dependentOffsets[ref + 1];
+        if (!hasTemplateRef(ref))
+        {
+            continue;
+        }
+        auto& dependents = templateComponent(ref)->m_Dependents;
+        dependents.resize(end - start);
+        for (auto i = start; i < end; i++)
+        {
+            dependents[i - start] = templateComponent(tmpl.dependents[i]);
+        }
+    }
+
+    m_DependencyOrder.resize(tmpl.dependencyOrder.size());
+    for (size_t i = 0; i < tmpl.dependencyOrder.size(); i++)
+    {
+        m_DependencyOrder[i] = templateComponent(tmpl.dependencyOrder[i]);
+    }
+    prepareDependencyOrder();
+
+    m_Drawables.resize(tmpl.drawables.size());
+    for (size_t i = 0; i < tmpl.drawables.size(); i++)
+    {
+        auto drawable = m_Objects[tmpl.drawables[i]]->as<Drawable>();
+        auto rulesId = tmpl.drawableRules[i];
+        drawable->flattenedDrawRules =
+            rulesId == 0 ? nullptr : m_Objects[rulesId]->as<DrawRules>();
+        m_Drawables[i] = drawable;
+    }
+
+    m_DrawTargets.resize(tmpl.drawTargets.size());
+    for (size_t i = 0; i < tmpl.drawTargets.size(); i++)
+    {
+        m_DrawTargets[i] = m_Objects[tmpl.drawTargets[i]]->as<DrawTarget>();
+    }
+}
+
 void Artboard::sortDrawOrder()
 {
     for (auto target : m_DrawTargets)
@@ -337,16 +683,277 @@ void Artboard::sortDrawOrder()
     m_FirstDrawable = lastDrawable;
 }
 
+void Artboard::buildChildIndex(Template& tmpl)
+{
+    // Counting sort of the components by parent id.
+    auto count = m_Objects.size();
+    auto& childOffsets = tmpl.childOffsets;
+    auto& childIds = tmpl.childIds;
+    childOffsets.assign(count + 1, 0);
+    for (auto object : m_Objects)
+    {
+        if (object != nullptr && object != this && object->is<Component>() &&
+            object->as<Component>()->parent() != nullptr)
+        {
+            childOffsets[object->as<Component>()->parentId() + 1]++;
+        }
+    }
+    for (size_t i = 0; i < count; i++)
+    {
+        childOffsets[i + 1] += childOffsets[i];
+    }
+    childIds.resize(childOffsets[count]);
+    std::vector<uint32_t> next(childOffsets.begin(), childOffsets.end() - 1);
+    for (uint32_t id = 0; id < count; id++)
+    {
+        auto object = m_Objects[id];
+        if (object != nullptr && object != this && object->is<Component>() &&
+            object->as<Component>()->parent() != nullptr)
+        {
+            childIds[next[object->as<Component>()->parentId()]++] = id;
+        }
+    }
+}
+
+Span<const uint32_t> Artboard::childIds(uint32_t id) const
+{
+    if (m_Template == nullptr || id + 1 >= m_Template->childOffsets.size())
+    {
+        return Span<const uint32_t>();
+    }
+    auto& offsets = m_Template->childOffsets;
+    return Span<const uint32_t>(m_Template->childIds.data() + offsets[id],
+                                offsets[id + 1] - offsets[id]);
+}
+
+void Artboard::subtreeIds(uint32_t id, std::vector<uint32_t>& ids) const
+{
+    auto start = ids.size();
+    ids.push_back(id);
+    // Breadth first using ids as the queue. Bail if we see more ids than
+    // there are objects, which can only happen if parents form a cycle.
+    for (auto i = start; i < ids.size() && ids.size() - start <= m_Objects.size(); i++)
+    {
+        for (auto childId : childIds(ids[i]))
+        {
+            ids.push_back(childId);
+        }
+    }
+    std::sort(ids.begin() + start, ids.end());
+}
+
 void Artboard::sortDependencies()
 {
+    // Component::addDependent doesn't look for duplicates, drop them here.
+    for (auto object : m_Objects)
+    {
+        if (object == nullptr || !object->is<Component>())
+        {
+            continue;
+        }
+        auto& dependents = object->as<Component>()->m_Dependents;
+        size_t unique = 0;
+        for (auto dependent : dependents)
+        {
+            if (dependent->m_SortMark == SortMark::none)
+            {
+                dependent->m_SortMark = SortMark::sorted;
+                dependents[unique++] = dependent;
+            }
+        }
+        dependents.resize(unique);
+        for (auto dependent : dependents)
+        {
+            dependent->m_SortMark = SortMark::none;
+        }
+    }
+
     DependencySorter sorter;
     sorter.sort(this, m_DependencyOrder);
+    prepareDependencyOrder();
+}
+
+void Artboard::prepareDependencyOrder()
+{
     unsigned int graphOrder = 0;
     for (auto component : m_DependencyOrder)
     {
         component->m_GraphOrder = graphOrder++;
     }
+
+    // Every component starts out dirty, so seed the worklist with all of
+    // them (skipping any that have already been cleaned).
+    m_DirtyComponents.assign((m_DependencyOrder.size() + 63) / 64, 0);
+    m_FirstDirtyWord = 0;
+    m_DirtyCount = 0;
+    for (auto component : m_DependencyOrder)
+    {
+        if (component->m_Dirt != ComponentDirt::None)
+        {
+            markComponentDirty(component->m_GraphOrder);
+        }
+    }
     m_Dirt |= ComponentDirt::Components;
+    // The levels are rebuilt from the new order when they're next needed.
+    m_LevelOrder.clear();
+    m_LevelStarts.clear();
+    m_CanUpdateLevelsInParallel =
+        std::none_of(m_DependencyOrder.begin(), m_DependencyOrder.end(), [](Component* component) {
+            return component->is<IKConstraint>();
+        });
+}
+
+void Artboard::markComponentDirty(unsigned int graphOrder)
+{
+    size_t word = graphOrder / 64;
+    uint64_t bit = uint64_t(1) << (graphOrder % 64);
+    uint64_t& bits = m_DirtyComponents[word];
+    if ((bits & bit) != 0)
+    {
+        return;
+    }
+    bits |= bit;
+    m_DirtyCount++;
+    if (word < m_FirstDirtyWord)
+    {
+        m_FirstDirtyWord = word;
+    }
+}
+
+int Artboard::popDirtyComponent()
+{
+    if (m_DirtyCount == 0)
+    {
+        return -1;
+    }
+    auto count = m_DirtyComponents.size();
+    for (; m_FirstDirtyWord < count; m_FirstDirtyWord++)
+    {
+        uint64_t& bits = m_DirtyComponents[m_FirstDirtyWord];
+        if (bits != 0)
+        {
+            int bit = __builtin_ctzll(bits);
+            // Clear the lowest set bit.
+            bits &= bits - 1;
+            m_DirtyCount--;
+            return static_cast<int>(m_FirstDirtyWord * 64 + bit);
+        }
+    }
+    assert(false);
+    return -1;
+}
+
+void Artboard::buildUpdateLevels()
+{
+    auto count = (uint32_t)m_DependencyOrder.size();
+    std::vector<uint32_t> levels(count, 0);
+    uint32_t levelCount = 0;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        // Dependents are sorted after what they depend on, so a component's
+        // level is final by the time it's reached.
+        auto level = levels[i];
+        levelCount = std::max(levelCount, level + 1);
+        for (auto dependent : m_DependencyOrder[i]->m_Dependents)
+        {
+            auto graphOrder = dependent->m_GraphOrder;
+            if (graphOrder < count && m_DependencyOrder[graphOrder] == dependent)
+            {
+                assert(graphOrder > i);
+                levels[graphOrder] = std::max(levels[graphOrder], level + 1);
+            }
+        }
+    }
+
+    // Counting sort by level, components in a level stay in graph order.
+    m_LevelStarts.assign(levelCount + 1, 0);
+    for (auto level : levels)
+    {
+        m_LevelStarts[level + 1]++;
+    }
+    for (uint32_t level = 0; level < levelCount; level++)
+    {
+        m_LevelStarts[level + 1] += m_LevelStarts[level];
+    }
+    m_LevelOrder.resize(count);
+    std::vector<uint32_t> next(m_LevelStarts.begin(), m_LevelStarts.end() - 1);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        m_LevelOrder[next[levels[i]]++] = i;
+    }
+}
+
+void Artboard::updateLevels()
+{
+    if (m_LevelStarts.empty())
+    {
+        buildUpdateLevels();
+    }
+    // Components are handed to the workers a few at a time.
+    const size_t chunkSize = 16;
+    auto levelCount = m_LevelStarts.size() - 1;
+    for (size_t level = 0; level < levelCount && m_DirtyCount != 0; level++)
+    {
+        // Everything the level depends on has updated, so its dirt is known.
+        m_LevelWork.clear();
+        for (auto i = m_LevelStarts[level]; i < m_LevelStarts[level + 1]; i++)
+        {
+            auto graphOrder = m_LevelOrder[i];
+            uint64_t& bits = m_DirtyComponents[graphOrder / 64];
+            uint64_t bit = uint64_t(1) << (graphOrder % 64);
+            if ((bits & bit) == 0)
+            {
+                continue;
+            }
+            bits &= ~bit;
+            m_DirtyCount--;
+            auto component = m_DependencyOrder[graphOrder];
+            if (component->m_Dirt != ComponentDirt::None)
+            {
+                m_LevelWork.push_back(component);
+            }
+        }
+
+        auto workCount = m_LevelWork.size();
+        auto updateChunk = [&](size_t chunk) {
+            auto start = chunk * chunkSize;
+            auto end = std::min(start + chunkSize, workCount);
+            ComponentDirt dirt[chunkSize];
+            {
+                // Others in the level can dirty these components while they
+                // update (see Component::addDirt), so take their dirt under
+                // the same lock. Dirt added after this gets another pass.
+                std::lock_guard<std::recursive_mutex> lock(m_DirtMutex);
+                for (size_t i = start; i < end; i++)
+                {
+                    dirt[i - start] = m_LevelWork[i]->m_Dirt;
+                    m_LevelWork[i]->m_Dirt = ComponentDirt::None;
+                }
+            }
+            for (size_t i = start; i < end; i++)
+            {
+                m_LevelWork[i]->update(dirt[i - start]);
+            }
+        };
+        auto chunkCount = (workCount + chunkSize - 1) / chunkSize;
+        if (workCount < 2 || workCount < m_MinParallelComponents)
+        {
+            for (size_t chunk = 0; chunk < chunkCount; chunk++)
+            {
+                updateChunk(chunk);
+            }
+            continue;
+        }
+        m_UpdatingInParallel = true;
+        m_UpdateWorkers->parallelFor(chunkCount, updateChunk);
+        m_UpdatingInParallel = false;
+    }
+}
+
+void Artboard::updateWorkers(WorkerPool* workers, size_t minComponents)
+{
+    m_UpdateWorkers = workers;
+    m_MinParallelComponents = minComponents;
 }
 
 void Artboard::addObject(Core* object) { m_Objects.push_back(object); }
@@ -387,6 +994,14 @@ void Artboard::onComponentDirty(Component* component)
 {
     m_Dirt |= ComponentDirt::Components;
 
+    // Components that aren't part of the dependency graph (or haven't been
+    // sorted yet) don't have a valid graph order.
+    auto graphOrder = component->graphOrder();
+    if (graphOrder < m_DependencyOrder.size() && m_DependencyOrder[graphOrder] == component)
+    {
+        markComponentDirty(graphOrder);
+    }
+
     /// If the order of the component is less than the current dirt
     /// depth, update the dirt depth so that the update loop can break
     /// out early and re-run (something up the tree is dirty).
@@ -416,8 +1031,13 @@ void Artboard::update(ComponentDirt value)
         {
             clip = bg;
         }
-        m_ClipPath = factory()->makeRenderPath(clip);
-        m_BackgroundPath = factory()->makeRenderPath(bg);
+        // Rebuild the paths made in initialize rather than making new ones.
+        m_ClipPath->reset();
+        m_ClipPath->fillRule(FillRule::nonZero);
+        m_ClipPath->addRect(clip.left(), clip.top(), clip.width(), clip.height());
+        m_BackgroundPath->reset();
+        m_BackgroundPath->fillRule(FillRule::nonZero);
+        m_BackgroundPath->addRect(bg.left(), bg.top(), bg.width(), bg.height());
     }
 }
 
@@ -427,34 +1047,43 @@ bool Artboard::updateComponents()
     {
         const int maxSteps = 100;
         int step = 0;
-        auto count = m_DependencyOrder.size();
         while (hasDirt(ComponentDirt::Components) && step < maxSteps)
         {
             m_Dirt = m_Dirt & ~ComponentDirt::Components;
 
-            // Track dirt depth here so that if something else marks
-            // dirty, we restart.
-            for (unsigned int i = 0; i < count; i++)
+            if (m_UpdateWorkers != nullptr && m_CanUpdateLevelsInParallel &&
+                m_DirtyCount >= m_MinParallelComponents)
             {
-                auto component = m_DependencyOrder[i];
-                m_DirtDepth = i;
-                auto d = component->m_Dirt;
-                if (d == ComponentDirt::None)
+                updateLevels();
+            }
+            else
+            {
+                // Only visit components that were marked dirty, in graph order.
+                // Track dirt depth here so that if something else marks dirty,
+                // we restart.
+                int i;
+                while ((i = popDirtyComponent()) != -1)
                 {
-                    continue;
-                }
-                component->m_Dirt = ComponentDirt::None;
-                component->update(d);
+                    auto component = m_DependencyOrder[i];
+                    m_DirtDepth = i;
+                    auto d = component->m_Dirt;
+                    if (d == ComponentDirt::None)
+                    {
+                        continue;
+                    }
+                    component->m_Dirt = ComponentDirt::None;
+                    component->update(d);
 
-                // If the update changed the dirt depth by adding dirt
-                // to something before us (in the DAG), early out and
-                // re-run the update.
-                if (m_DirtDepth < i)
-                {
-                    // We put this in here just to know if we need to
-                    // keep this around...
-                    assert(false);
-                    break;
+                    // If the update changed the dirt depth by adding dirt
+                    // to something before us (in the DAG), early out and
+                    // re-run the update.
+                    if (m_DirtDepth < (unsigned int)i)
+                    {
+                        // We put this in here just to know if we need to
+                        // keep this around...
+                        assert(false);
+                        break;
+                    }
                 }
             }
             step++;
@@ -651,7 +1280,21 @@ int Artboard::defaultStateMachineIndex() const
     return index;
 }
 
-std::unique_ptr<ArtboardInstance> Artboard::instance() const
+bool Artboard::inObjectArena(const Core* object) const
+{
+    auto address = reinterpret_cast<const uint8_t*>(object);
+    auto arena = m_ObjectArena.get();
+    return arena != nullptr && address >= arena && address < arena + m_ObjectArenaSize;
+}
+
+// Keeps every object in the arena aligned for any type.
+static size_t alignedCloneSize(const Core* object)
+{
+    const size_t alignment = alignof(std::max_align_t);
+    return (object->cloneSize() + alignment - 1) & ~(alignment - 1);
+}
+
+std::unique_ptr<ArtboardInstance> Artboard::instance(ObjectAllocation allocation) const
 {
     std::unique_ptr<ArtboardInstance> artboardClone(new ArtboardInstance);
     artboardClone->copy(*this);
@@ -663,14 +1306,43 @@ std::unique_ptr<ArtboardInstance> Artboard::instance() const
     std::vector<Core*>& cloneObjects = artboardClone->m_Objects;
     cloneObjects.push_back(artboardClone.get());
 
+    if (allocation == ObjectAllocation::arena && m_Objects.size() > 1)
+    {
+        size_t arenaSize = 0;
+        for (auto itr = m_Objects.begin() + 1; itr != m_Objects.end(); itr++)
+        {
+            if (*itr != nullptr)
+            {
+                arenaSize += alignedCloneSize(*itr);
+            }
+        }
+        // operator new[] aligns for any fundamental type.
+        artboardClone->m_ObjectArena.reset(new uint8_t[arenaSize]);
+        artboardClone->m_ObjectArenaSize = arenaSize;
+    }
+
     if (!m_Objects.empty())
     {
+        cloneObjects.reserve(m_Objects.size());
+        uint8_t* memory = artboardClone->m_ObjectArena.get();
         // Skip first object (artboard).
         auto itr = m_Objects.begin();
         while (++itr != m_Objects.end())
         {
             auto object = *itr;
-            cloneObjects.push_back(object == nullptr ? nullptr : object->clone());
+            if (object == nullptr)
+            {
+                cloneObjects.push_back(nullptr);
+            }
+            else if (memory != nullptr && object->cloneSize() != 0)
+            {
+                cloneObjects.push_back(object->cloneInto(memory));
+                memory += alignedCloneSize(object);
+            }
+            else
+            {
+                cloneObjects.push_back(object->clone());
+            }
         }
     }
 
@@ -682,6 +1354,8 @@ std::unique_ptr<ArtboardInstance> Artboard::instance() const
     {
         artboardClone->m_StateMachines.push_back(stateMachine);
     }
+    // Wire the clone with the graphs we already computed.
+    artboardClone->m_Template = m_Template;
 
     if (artboardClone->initialize() != StatusCode::Ok)
     {
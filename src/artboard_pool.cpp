@@ -0,0 +1,27 @@
+#include "rive/artboard_pool.hpp"
+
+using namespace rive;
+
+ArtboardPool::ArtboardPool(const Artboard* artboard, size_t maxIdle) :
+    m_Artboard(artboard), m_MaxIdle(maxIdle)
+{}
+
+std::unique_ptr<ArtboardInstance> ArtboardPool::acquire()
+{
+    if (m_Idle.empty())
+    {
+        return m_Artboard->instance();
+    }
+    auto instance = std::move(m_Idle.back());
+    m_Idle.pop_back();
+    return instance;
+}
+
+void ArtboardPool::release(std::unique_ptr<ArtboardInstance> instance)
+{
+    // Reset now so acquiring stays cheap.
+    if (m_Idle.size() < m_MaxIdle && m_Artboard->resetInstance(instance.get()))
+    {
+        m_Idle.push_back(std::move(instance));
+    }
+}
@@ -0,0 +1,44 @@
+#include "rive/assets/asset_decoder.hpp"
+#include "rive/assets/file_asset.hpp"
+#include "rive/worker_pool.hpp"
+
+using namespace rive;
+
+AssetDecoder::AssetDecoder(WorkerPool* workers, Factory* factory) :
+    m_Workers(workers), m_Factory(factory)
+{}
+
+AssetDecoder::~AssetDecoder() { wait(); }
+
+void AssetDecoder::decode(FileAsset* asset, Span<const uint8_t> contents)
+{
+    auto completion = startLoad();
+    auto factory = m_Factory;
+    m_Workers->submit([asset, contents, factory, completion]() {
+        asset->decode(contents, factory);
+        completion->complete();
+    });
+}
+
+FileAssetResolver::Completion* AssetDecoder::startLoad()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Pending++;
+    return this;
+}
+
+void AssetDecoder::complete()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    assert(m_Pending > 0);
+    if (--m_Pending == 0)
+    {
+        m_Finished.notify_all();
+    }
+}
+
+void AssetDecoder::wait()
+{
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_Finished.wait(lock, [this] { return m_Pending == 0; });
+}
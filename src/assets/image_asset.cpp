@@ -4,20 +4,20 @@
 
 using namespace rive;
 
-ImageAsset::~ImageAsset() {}
+ImageAsset::~ImageAsset() { delete m_RenderImage.load(); }
 
 bool ImageAsset::decode(Span<const uint8_t> data, Factory* factory)
 {
 #ifdef TESTING
     decodedByteSize = data.size();
 #endif
-    m_RenderImage = factory->decodeImage(data);
-    return m_RenderImage != nullptr;
+    renderImage(factory->decodeImage(data));
+    return this->renderImage() != nullptr;
 }
 
 void ImageAsset::renderImage(std::unique_ptr<RenderImage> renderImage)
 {
-    m_RenderImage = std::move(renderImage);
+    delete m_RenderImage.exchange(renderImage.release(), std::memory_order_acq_rel);
 }
 
 std::string ImageAsset::fileExtension() { return "png"; }
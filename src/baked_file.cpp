@@ -0,0 +1,237 @@
+#include "rive/baked_file.hpp"
+#include "rive/core/reader.h"
+#include <cstdio>
+
+using namespace rive;
+
+static const uint8_t bakedMagic[4] = {'R', 'I', 'V', 'B'};
+static const size_t headerSize = 32;
+static const uint32_t hasTemplateFlag = 1 << 0;
+static const uint32_t hasWiringFlag = 1 << 1;
+
+static uint32_t checksum(Span<const uint8_t> bytes)
+{
+    // FNV-1a.
+    uint32_t hash = 2166136261u;
+    for (auto byte : bytes)
+    {
+        hash = (hash ^ byte) * 16777619u;
+    }
+    return hash;
+}
+
+namespace
+{
+class BakedWriter
+{
+private:
+    std::vector<uint8_t> m_Bytes;
+
+public:
+    std::vector<uint8_t>& bytes() { return m_Bytes; }
+
+    void write(uint32_t value)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            m_Bytes.push_back((uint8_t)(value >> (i * 8)));
+        }
+    }
+
+    void write(const std::vector<uint32_t>& table)
+    {
+        write((uint32_t)table.size());
+        for (auto value : table)
+        {
+            write(value);
+        }
+    }
+
+    void set(size_t offset, uint32_t value)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            m_Bytes[offset + i] = (uint8_t)(value >> (i * 8));
+        }
+    }
+};
+
+class BakedReader
+{
+private:
+    Span<const uint8_t> m_Bytes;
+    size_t m_Position;
+    bool m_Overflowed = false;
+
+public:
+    BakedReader(Span<const uint8_t> bytes, size_t position) :
+        m_Bytes(bytes), m_Position(position)
+    {}
+
+    bool didOverflow() const { return m_Overflowed; }
+
+    uint32_t read()
+    {
+        if (m_Overflowed || m_Bytes.size() - m_Position < 4)
+        {
+            m_Overflowed = true;
+            return 0;
+        }
+        auto bytes = m_Bytes.data() + m_Position;
+        m_Position += 4;
+        return bytes[0] | bytes[1] << 8 | bytes[2] << 16 | (uint32_t)bytes[3] << 24;
+    }
+
+    void read(std::vector<uint32_t>& table)
+    {
+        auto count = read();
+        if (m_Overflowed || (m_Bytes.size() - m_Position) / 4 < count)
+        {
+            m_Overflowed = true;
+            return;
+        }
+        table.resize(count);
+        if (is_big_endian())
+        {
+            for (auto& value : table)
+            {
+                value = read();
+            }
+        }
+        else
+        {
+            memcpy(table.data(), m_Bytes.data() + m_Position, count * 4);
+            m_Position += count * 4;
+        }
+    }
+};
+} // namespace
+
+bool BakedFile::isBaked(Span<const uint8_t> data)
+{
+    return data.size() >= sizeof(bakedMagic) &&
+           memcmp(data.data(), bakedMagic, sizeof(bakedMagic)) == 0;
+}
+
+std::vector<uint8_t> BakedFile::bake(Span<const uint8_t> data,
+                                     Factory* factory,
+                                     ImportResult* result)
+{
+    ImportResult importResult;
+    auto file = File::import(data, factory, &importResult);
+    if (result)
+    {
+        *result = file == nullptr ? importResult : ImportResult::success;
+    }
+    if (file == nullptr)
+    {
+        return {};
+    }
+
+    BakedWriter writer;
+    writer.bytes().insert(writer.bytes().end(), bakedMagic, bakedMagic + sizeof(bakedMagic));
+    writer.write(version);
+    writer.write(File::majorVersion);
+    writer.write(File::minorVersion);
+    // The riv offset, riv size and checksum are set once they're known.
+    writer.write(0);
+    writer.write(0);
+    writer.write(0);
+    writer.write((uint32_t)file->m_Artboards.size());
+    for (auto& artboard : file->m_Artboards)
+    {
+        auto tmpl = artboard->m_Template.get();
+        if (tmpl == nullptr)
+        {
+            writer.write(0);
+            continue;
+        }
+        writer.write(hasTemplateFlag | (tmpl->hasWiring ? hasWiringFlag : 0));
+        writer.write(tmpl->childOffsets);
+        writer.write(tmpl->childIds);
+        if (tmpl->hasWiring)
+        {
+            writer.write(tmpl->dependentOffsets);
+            writer.write(tmpl->dependents);
+            writer.write(tmpl->dependencyOrder);
+            writer.write(tmpl->drawables);
+            writer.write(tmpl->drawableRules);
+            writer.write(tmpl->drawTargets);
+        }
+    }
+
+    auto& bytes = writer.bytes();
+    auto rivOffset = (uint32_t)bytes.size();
+    writer.set(16, rivOffset);
+    writer.set(20, (uint32_t)data.size());
+    writer.set(24, checksum(Span<const uint8_t>(bytes).subset(headerSize, rivOffset - headerSize)));
+    bytes.insert(bytes.end(), data.begin(), data.end());
+    return std::move(bytes);
+}
+
+ImportResult BakedFile::read(Span<const uint8_t> data,
+                             Span<const uint8_t>& riv,
+                             std::vector<rcp<Artboard::Template>>& templates)
+{
+    if (!isBaked(data) || data.size() < headerSize)
+    {
+        return ImportResult::malformed;
+    }
+    BakedReader header(data, sizeof(bakedMagic));
+    auto bakedVersion = header.read();
+    auto major = header.read();
+    auto minor = header.read();
+    if (bakedVersion != version || major != File::majorVersion || minor != File::minorVersion)
+    {
+        fprintf(stderr,
+                "Unsupported baked file version %u (runtime %u.%u) expected %u (runtime %u.%u).\n",
+                bakedVersion,
+                major,
+                minor,
+                version,
+                File::majorVersion,
+                File::minorVersion);
+        return ImportResult::unsupportedVersion;
+    }
+    auto rivOffset = header.read();
+    auto rivSize = header.read();
+    auto expectedChecksum = header.read();
+    auto artboardCount = header.read();
+    // Every artboard takes at least a flags word.
+    if (rivOffset < headerSize || rivOffset % 4 != 0 || rivOffset > data.size() ||
+        data.size() - rivOffset != rivSize || artboardCount > (rivOffset - headerSize) / 4 ||
+        checksum(data.subset(headerSize, rivOffset - headerSize)) != expectedChecksum)
+    {
+        return ImportResult::malformed;
+    }
+
+    BakedReader reader(data.subset(0, rivOffset), headerSize);
+    templates.resize(artboardCount);
+    for (auto& tmpl : templates)
+    {
+        auto flags = reader.read();
+        if ((flags & hasTemplateFlag) == 0)
+        {
+            continue;
+        }
+        tmpl = rcp<Artboard::Template>(new Artboard::Template());
+        tmpl->hasWiring = (flags & hasWiringFlag) != 0;
+        reader.read(tmpl->childOffsets);
+        reader.read(tmpl->childIds);
+        if (tmpl->hasWiring)
+        {
+            reader.read(tmpl->dependentOffsets);
+            reader.read(tmpl->dependents);
+            reader.read(tmpl->dependencyOrder);
+            reader.read(tmpl->drawables);
+            reader.read(tmpl->drawableRules);
+            reader.read(tmpl->drawTargets);
+        }
+        if (reader.didOverflow())
+        {
+            return ImportResult::malformed;
+        }
+    }
+    riv = data.subset(rivOffset, rivSize);
+    return ImportResult::success;
+}
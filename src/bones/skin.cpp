@@ -57,7 +57,10 @@ void Skin::buildDependencies()
             constraint->parent()->addDependent(this);
         }
     }
+}
 
+void Skin::onResolved()
+{
     // Make sure no-one is calling this twice.
     assert(m_BoneTransforms == nullptr);
     // We can now init the bone buffer.
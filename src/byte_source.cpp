@@ -0,0 +1,110 @@
+#include "rive/byte_source.hpp"
+#include <cstdio>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define RIVE_HAS_MMAP
+#endif
+
+using namespace rive;
+
+namespace
+{
+class OwnedByteSource : public ByteSource
+{
+private:
+    std::vector<uint8_t> m_Bytes;
+
+public:
+    explicit OwnedByteSource(std::vector<uint8_t> bytes) : m_Bytes(std::move(bytes)) {}
+    Span<const uint8_t> bytes() const override { return m_Bytes; }
+};
+
+class UnownedByteSource : public ByteSource
+{
+private:
+    Span<const uint8_t> m_Bytes;
+
+public:
+    explicit UnownedByteSource(Span<const uint8_t> bytes) : m_Bytes(bytes) {}
+    Span<const uint8_t> bytes() const override { return m_Bytes; }
+};
+
+#ifdef RIVE_HAS_MMAP
+class MappedByteSource : public ByteSource
+{
+private:
+    void* m_Memory;
+    size_t m_Size;
+
+public:
+    MappedByteSource(void* memory, size_t size) : m_Memory(memory), m_Size(size) {}
+    ~MappedByteSource() override { munmap(m_Memory, m_Size); }
+    Span<const uint8_t> bytes() const override
+    {
+        return Span<const uint8_t>(static_cast<const uint8_t*>(m_Memory), m_Size);
+    }
+};
+#endif
+} // namespace
+
+rcp<ByteSource> ByteSource::make(std::vector<uint8_t> bytes)
+{
+    return rcp<ByteSource>(new OwnedByteSource(std::move(bytes)));
+}
+
+rcp<ByteSource> ByteSource::makeUnowned(Span<const uint8_t> bytes)
+{
+    return rcp<ByteSource>(new UnownedByteSource(bytes));
+}
+
+rcp<ByteSource> ByteSource::mapFile(const char* path)
+{
+#ifdef RIVE_HAS_MMAP
+    int fd = open(path, O_RDONLY);
+    if (fd == -1)
+    {
+        return nullptr;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0)
+    {
+        close(fd);
+        return nullptr;
+    }
+    size_t size = (size_t)info.st_size;
+    if (size == 0)
+    {
+        close(fd);
+        return make({});
+    }
+    void* memory = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping keeps the file alive.
+    close(fd);
+    if (memory == MAP_FAILED)
+    {
+        return nullptr;
+    }
+    return rcp<ByteSource>(new MappedByteSource(memory, size));
+#else
+    FILE* fp = fopen(path, "rb");
+    if (fp == nullptr)
+    {
+        return nullptr;
+    }
+    fseek(fp, 0, SEEK_END);
+    long length = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    std::vector<uint8_t> bytes(length < 0 ? 0 : (size_t)length);
+    size_t read = fread(bytes.data(), 1, bytes.size(), fp);
+    fclose(fp);
+    if (read != bytes.size())
+    {
+        return nullptr;
+    }
+    return make(std::move(bytes));
+#endif
+}
@@ -4,7 +4,6 @@
 #include "rive/core_context.hpp"
 #include "rive/importers/artboard_importer.hpp"
 #include "rive/importers/import_stack.hpp"
-#include <algorithm>
 
 using namespace rive;
 
@@ -25,18 +24,18 @@ StatusCode Component::onAddedDirty(CoreContext* context)
     return StatusCode::Ok;
 }
 
-void Component::addDependent(Component* component)
+void Component::addDependent(Component* component) { m_Dependents.push_back(component); }
+
+bool Component::addDirt(ComponentDirt value, bool recurse)
 {
-    // Make it's not already a dependent.
-    if (std::find(m_Dependents.begin(), m_Dependents.end(), component) != m_Dependents.end())
+    // Components updating in parallel can dirty the same dependents (see
+    // Artboard::updateWorkers).
+    std::unique_lock<std::recursive_mutex> lock;
+    if (m_Artboard != nullptr && m_Artboard->m_UpdatingInParallel)
     {
-        return;
+        lock = std::unique_lock<std::recursive_mutex>(m_Artboard->m_DirtMutex);
     }
-    m_Dependents.push_back(component);
-}
 
-bool Component::addDirt(ComponentDirt value, bool recurse)
-{
     if ((m_Dirt & value) == value)
     {
         // Already marked.
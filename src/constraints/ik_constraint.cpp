@@ -58,25 +58,26 @@ StatusCode IKConstraint::onAddedClean(CoreContext* context)
 
     auto artboard = static_cast<Artboard*>(context);
 
-    // Find all children of this bone (we don't directly build up
-    // hierarchy at runtime, so we have to traverse everything and check
-    // parents).
-    for (auto core : artboard->objects())
+    // Find all children of the bones above the tip (in the order they're in
+    // the artboard).
+    std::vector<uint32_t> childIds;
+    for (int i = 1; i < numBones; i++)
     {
-        if (core == nullptr || !core->is<TransformComponent>())
+        // bones[i] is the parent of bones[i - 1].
+        for (auto id : artboard->childIds(bones[i - 1]->parentId()))
         {
-            continue;
+            childIds.push_back(id);
         }
-        auto transformComponent = core->as<TransformComponent>();
-
-        for (int i = 1; i < numBones; i++)
+    }
+    std::sort(childIds.begin(), childIds.end());
+    auto& objects = artboard->objects();
+    for (auto id : childIds)
+    {
+        auto core = objects[id];
+        if (core->is<TransformComponent>() &&
+            std::find(bones.begin(), bones.end(), core) == bones.end())
         {
-            auto bone = bones[i];
-            if (transformComponent->parent() == bone &&
-                std::find(bones.begin(), bones.end(), transformComponent) == bones.end())
-            {
-                tip->addDependent(transformComponent);
-            }
+            tip->addDependent(core->as<TransformComponent>());
         }
     }
     return Super::onAddedClean(context);
@@ -1,5 +1,6 @@
 #include "rive/core/binary_reader.hpp"
 #include "rive/core/reader.h"
+#include "rive/math/simd.hpp"
 #include "rive/span.hpp"
 #include <vector>
 
@@ -33,10 +34,46 @@ void BinaryReader::intRangeError()
     m_Position = m_Bytes.end();
 }
 
-uint64_t BinaryReader::readVarUint64()
+// The longest a LEB128 encoded uint64_t can be.
+static const size_t maxVarUintBytes = 10;
+
+// Decodes the LEB128 value at bytes, which must have at least
+// maxVarUintBytes readable and take more than one byte, without checking for
+// the end on each byte. Returns the number of bytes read, 0 if the value is
+// longer than a uint64_t can be.
+static size_t decodeVarUintUnchecked(const uint8_t* bytes, uint64_t* value)
+{
+    // Two bytes covers most of the rest (ids and indices under 16384).
+    if (bytes[1] < 0x80)
+    {
+        *value = (bytes[0] & 0x7f) | (uint64_t)bytes[1] << 7;
+        return 2;
+    }
+    uint64_t result = (bytes[0] & 0x7f) | (uint64_t)(bytes[1] & 0x7f) << 7;
+    for (size_t i = 2; i < maxVarUintBytes; i++)
+    {
+        result |= (uint64_t)(bytes[i] & 0x7f) << (i * 7);
+        if (bytes[i] < 0x80)
+        {
+            *value = result;
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+uint64_t BinaryReader::readMultiByteVarUint64()
 {
     uint64_t value;
-    auto readBytes = decode_uint_leb(m_Position, m_Bytes.end(), &value);
+    size_t readBytes;
+    if ((size_t)(m_Bytes.end() - m_Position) >= maxVarUintBytes)
+    {
+        readBytes = decodeVarUintUnchecked(m_Position, &value);
+    }
+    else
+    {
+        readBytes = decode_uint_leb(m_Position, m_Bytes.end(), &value);
+    }
     if (readBytes == 0)
     {
         overflow();
@@ -46,23 +83,91 @@ uint64_t BinaryReader::readVarUint64()
     return value;
 }
 
-std::string BinaryReader::readString()
+uint64_t BinaryReader::peekVarUint64() const
 {
-    uint64_t length = readVarUint64();
-    if (didOverflow())
+    uint64_t value;
+    if (decode_uint_leb(m_Position, m_Bytes.end(), &value) == 0)
     {
-        return std::string();
+        return 0;
     }
+    return value;
+}
 
-    std::vector<char> rawValue((size_t)length + 1);
-    auto readBytes = decode_string(length, m_Position, m_Bytes.end(), &rawValue[0]);
-    if (readBytes != length)
+void BinaryReader::readVarUint16s(std::vector<uint16_t>& values)
+{
+    // Every value ends with the one byte that doesn't have its high bit set,
+    // count them (16 bytes at a time) to size values up front.
+    const uint32_t highBits = 0x80808080u;
+    const uint8_t* bytes = m_Position;
+    const uint8_t* end = m_Bytes.end();
+    uint4 counts = {0, 0, 0, 0};
+    for (; end - bytes >= 16; bytes += 16)
     {
-        overflow();
-        return std::string();
+        uint4 ends = ~simd::load4ui(bytes) & highBits;
+        // Sum each word's flags into its top byte.
+        counts += ((ends >> 7) * 0x01010101u) >> 24;
     }
-    m_Position += readBytes;
-    return std::string(rawValue.data(), (size_t)length);
+    size_t count = counts[0] + counts[1] + counts[2] + counts[3];
+    for (; bytes < end; bytes++)
+    {
+        count += *bytes < 0x80;
+    }
+
+    size_t index = values.size();
+    values.resize(index + count);
+    uint16_t* output = values.data();
+    while (m_Position != end)
+    {
+        // Runs of single byte values are widened 16 at a time.
+        while (end - m_Position >= 16)
+        {
+            if (simd::any((simd::load4ui(m_Position) & highBits) != 0))
+            {
+                break;
+            }
+            auto run = simd::load<uint8_t, 16>(m_Position);
+            simd::store(output + index, __builtin_convertvector(run, simd::gvec<uint16_t, 16>));
+            index += 16;
+            m_Position += 16;
+        }
+        if (m_Position == end)
+        {
+            break;
+        }
+        auto value = readVarUint64();
+        if (hasError())
+        {
+            break;
+        }
+        if (!fitsIn<uint16_t>(value))
+        {
+            intRangeError();
+            break;
+        }
+        output[index++] = (uint16_t)value;
+    }
+    // Only the values read before an error are kept.
+    values.resize(index);
+}
+
+std::string BinaryReader::readString()
+{
+    auto bytes = readBytes();
+    return std::string(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+}
+
+SharedString BinaryReader::readSharedString()
+{
+    auto bytes = readBytes();
+    std::string_view key(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    auto itr = m_SharedStrings.find(key);
+    if (itr != m_SharedStrings.end())
+    {
+        return itr->second;
+    }
+    SharedString value{std::string(key)};
+    m_SharedStrings.emplace(key, value);
+    return value;
 }
 
 Span<const uint8_t> BinaryReader::readBytes()
@@ -72,6 +177,11 @@ Span<const uint8_t> BinaryReader::readBytes()
     {
         return Span<const uint8_t>(m_Position, 0);
     }
+    if (length > (uint64_t)(m_Bytes.end() - m_Position))
+    {
+        overflow();
+        return Span<const uint8_t>(m_Position, 0);
+    }
 
     const uint8_t* start = m_Position;
     m_Position += length;
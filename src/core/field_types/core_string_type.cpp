@@ -3,4 +3,7 @@
 
 using namespace rive;
 
-std::string CoreStringType::deserialize(BinaryReader& reader) { return reader.readString(); }
\ No newline at end of file
+SharedString CoreStringType::deserialize(BinaryReader& reader)
+{
+    return reader.readSharedString();
+}
\ No newline at end of file
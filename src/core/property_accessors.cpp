@@ -0,0 +1,17 @@
+#include "rive/core/property_accessors.hpp"
+#include "rive/generated/core_registry.hpp"
+
+using namespace rive;
+
+PropertyAccessors PropertyAccessors::resolve(int propertyKey)
+{
+    PropertyAccessors accessors;
+    accessors.setDouble = CoreRegistry::doubleSetter(propertyKey);
+    accessors.getDouble = CoreRegistry::doubleGetter(propertyKey);
+    accessors.setColor = CoreRegistry::colorSetter(propertyKey);
+    accessors.getColor = CoreRegistry::colorGetter(propertyKey);
+    accessors.setBool = CoreRegistry::boolSetter(propertyKey);
+    accessors.setUint = CoreRegistry::uintSetter(propertyKey);
+    return accessors;
+}
+
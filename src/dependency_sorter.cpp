@@ -1,38 +1,55 @@
 #include "rive/dependency_sorter.hpp"
 #include "rive/component.hpp"
+#include <algorithm>
 
 using namespace rive;
 
 void DependencySorter::sort(Component* root, std::vector<Component*>& order)
 {
     order.clear();
-    visit(root, order);
-}
+    m_Stack.clear();
 
-bool DependencySorter::visit(Component* component, std::vector<Component*>& order)
-{
-    if (m_Perm.find(component) != m_Perm.end())
-    {
-        return true;
-    }
-    if (m_Temp.find(component) != m_Temp.end())
+    // Depth first, a component is added once all of its dependents have been,
+    // so the reverse of that is the order we want. Marks live on the
+    // components to keep this linear in the size of the graph.
+    root->m_SortMark = Component::SortMark::visiting;
+    m_Stack.push_back({root, 0});
+    while (!m_Stack.empty())
     {
-        fprintf(stderr, "Dependency cycle!\n");
-        return false;
-    }
-
-    m_Temp.emplace(component);
+        auto& frame = m_Stack.back();
+        auto component = frame.component;
+        auto& dependents = component->dependents();
+        if (frame.nextDependent == dependents.size())
+        {
+            component->m_SortMark = Component::SortMark::sorted;
+            order.push_back(component);
+            m_Stack.pop_back();
+            continue;
+        }
 
-    auto dependents = component->dependents();
-    for (auto dependent : dependents)
-    {
-        if (!visit(dependent, order))
+        auto dependent = dependents[frame.nextDependent++];
+        switch (dependent->m_SortMark)
         {
-            return false;
+            case Component::SortMark::sorted:
+                break;
+            case Component::SortMark::visiting:
+                fprintf(stderr, "Dependency cycle!\n");
+                for (auto& visiting : m_Stack)
+                {
+                    visiting.component->m_SortMark = Component::SortMark::none;
+                }
+                m_Stack.clear();
+                break;
+            case Component::SortMark::none:
+                dependent->m_SortMark = Component::SortMark::visiting;
+                m_Stack.push_back({dependent, 0});
+                break;
         }
     }
-    m_Perm.emplace(component);
-    order.insert(order.begin(), component);
 
-    return true;
-}
\ No newline at end of file
+    std::reverse(order.begin(), order.end());
+    for (auto component : order)
+    {
+        component->m_SortMark = Component::SortMark::none;
+    }
+}
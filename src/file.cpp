@@ -1,7 +1,9 @@
 #include "rive/file.hpp"
+#include "rive/baked_file.hpp"
 #include "rive/rive_counter.hpp"
 #include "rive/runtime_header.hpp"
 #include "rive/animation/animation.hpp"
+#include "rive/assets/asset_decoder.hpp"
 #include "rive/core/field_types/core_color_type.hpp"
 #include "rive/core/field_types/core_double_type.hpp"
 #include "rive/core/field_types/core_string_type.hpp"
@@ -28,6 +30,9 @@
 #include "rive/animation/blend_state_direct.hpp"
 #include "rive/assets/file_asset.hpp"
 #include "rive/assets/file_asset_contents.hpp"
+#include "rive/assets/folder.hpp"
+#include "rive/nested_artboard.hpp"
+#include "rive/worker_pool.hpp"
 
 // Default namespace for Rive Cpp code
 using namespace rive;
@@ -53,7 +58,7 @@ using namespace rive;
 
 // Import a single Rive runtime object.
 // Used by the file importer.
-static Core* readRuntimeObject(BinaryReader& reader, const RuntimeHeader& header)
+Core* File::readRuntimeObject(BinaryReader& reader, const RuntimeHeader& header)
 {
     auto coreObjectKey = reader.readVarUintAs<int>();
     auto object = CoreRegistry::makeCoreInstance(coreObjectKey);
@@ -120,6 +125,56 @@ static Core* readRuntimeObject(BinaryReader& reader, const RuntimeHeader& header
     return object;
 }
 
+bool File::skipRuntimeObject(BinaryReader& reader, const RuntimeHeader& header)
+{
+    reader.readVarUint64();
+    while (true)
+    {
+        auto propertyKey = reader.readVarUintAs<uint16_t>();
+        if (propertyKey == 0 || reader.hasError())
+        {
+            break;
+        }
+        int id = CoreRegistry::propertyFieldId(propertyKey);
+        if (id == -1)
+        {
+            id = header.propertyFieldId(propertyKey);
+        }
+        switch (id)
+        {
+            case CoreUintType::id:
+                CoreUintType::deserialize(reader);
+                break;
+            case CoreStringType::id:
+                reader.readBytes();
+                break;
+            case CoreDoubleType::id:
+                CoreDoubleType::deserialize(reader);
+                break;
+            case CoreColorType::id:
+                CoreColorType::deserialize(reader);
+                break;
+            default:
+                return false;
+        }
+    }
+    return !reader.hasError();
+}
+
+bool File::isFileObject(uint64_t typeKey)
+{
+    switch (typeKey)
+    {
+        case Backboard::typeKey:
+        case Artboard::typeKey:
+        case Folder::typeKey:
+        case ImageAsset::typeKey:
+        case FileAssetContents::typeKey:
+            return true;
+    }
+    return false;
+}
+
 File::File(Factory* factory, FileAssetResolver* assetResolver) :
     m_Factory(factory), m_AssetResolver(assetResolver)
 {
@@ -128,13 +183,43 @@ File::File(Factory* factory, FileAssetResolver* assetResolver) :
     assert(factory);
 }
 
-File::~File() { Counter::update(Counter::kFile, -1); }
+File::~File()
+{
+    // Decodes still running refer to the assets and the bytes they came from.
+    waitForAssets();
+    Counter::update(Counter::kFile, -1);
+}
 
 std::unique_ptr<File> File::import(Span<const uint8_t> bytes,
                                    Factory* factory,
                                    ImportResult* result,
                                    FileAssetResolver* assetResolver)
 {
+    return import(bytes, nullptr, ArtboardLoading::eager, nullptr, factory, result, assetResolver);
+}
+
+std::unique_ptr<File> File::import(Span<const uint8_t> bytes,
+                                   rcp<ByteSource> source,
+                                   ArtboardLoading loading,
+                                   WorkerPool* workers,
+                                   Factory* factory,
+                                   ImportResult* result,
+                                   FileAssetResolver* assetResolver)
+{
+    std::vector<rcp<Artboard::Template>> bakedTemplates;
+    if (BakedFile::isBaked(bytes))
+    {
+        auto bakedResult = BakedFile::read(bytes, bytes, bakedTemplates);
+        if (bakedResult != ImportResult::success)
+        {
+            if (result)
+            {
+                *result = bakedResult;
+            }
+            return nullptr;
+        }
+    }
+
     BinaryReader reader(bytes);
     RuntimeHeader header;
     if (!RuntimeHeader::read(reader, header))
@@ -161,7 +246,25 @@ std::unique_ptr<File> File::import(Span<const uint8_t> bytes,
         return nullptr;
     }
     auto file = std::unique_ptr<File>(new File(factory, assetResolver));
+    file->m_Source = std::move(source);
+    file->m_BakedTemplates = std::move(bakedTemplates);
+    if (workers != nullptr && workers->threadCount() > 1 && factory->canDecodeConcurrently())
+    {
+        file->m_AssetDecoder = std::make_unique<AssetDecoder>(workers, factory);
+    }
+    // Artboards imported across workers are indexed like lazy ones first.
+    bool parallel = loading == ArtboardLoading::eager && workers != nullptr &&
+                    workers->threadCount() > 1;
+    file->m_ArtboardLoading = parallel ? ArtboardLoading::lazy : loading;
+    if (file->m_ArtboardLoading == ArtboardLoading::lazy)
+    {
+        file->m_Header = std::make_unique<RuntimeHeader>(header);
+    }
     auto readResult = file->read(reader, header);
+    if (parallel && readResult == ImportResult::success)
+    {
+        readResult = file->loadArtboards(workers);
+    }
     if (readResult != ImportResult::success)
     {
         file.reset(nullptr);
@@ -173,9 +276,41 @@ std::unique_ptr<File> File::import(Span<const uint8_t> bytes,
     return file;
 }
 
+std::unique_ptr<File> File::import(rcp<ByteSource> source,
+                                   Factory* factory,
+                                   ImportResult* result,
+                                   FileAssetResolver* assetResolver,
+                                   ArtboardLoading loading,
+                                   WorkerPool* workers)
+{
+    if (source == nullptr)
+    {
+        if (result)
+        {
+            *result = ImportResult::malformed;
+        }
+        return nullptr;
+    }
+    auto bytes = source->bytes();
+    return import(bytes, std::move(source), loading, workers, factory, result, assetResolver);
+}
+
 ImportResult File::read(BinaryReader& reader, const RuntimeHeader& header)
 {
     ImportStack importStack;
+    auto result = readObjects(reader, header, importStack);
+    if (result != ImportResult::success)
+    {
+        return result;
+    }
+    return !reader.hasError() && importStack.resolve() == StatusCode::Ok ? ImportResult::success
+                                                                         : ImportResult::malformed;
+}
+
+ImportResult File::readObjects(BinaryReader& reader,
+                               const RuntimeHeader& header,
+                               ImportStack& importStack)
+{
     while (!reader.reachedEnd())
     {
         auto object = readRuntimeObject(reader, header);
@@ -184,120 +319,266 @@ ImportResult File::read(BinaryReader& reader, const RuntimeHeader& header)
             importStack.readNullObject();
             continue;
         }
-        if (object->import(importStack) == StatusCode::Ok)
+        if (m_ArtboardLoading == ArtboardLoading::lazy && object->is<Artboard>())
         {
-            switch (object->coreType())
+            // Index the artboard's objects, they're imported when the artboard
+            // is first asked for.
+            auto start = reader.position();
+            uint32_t objectCount = 0;
+            while (!reader.reachedEnd() && !isFileObject(reader.peekVarUint64()))
             {
-                case Backboard::typeKey:
-                    m_Backboard.reset(object->as<Backboard>());
-                    break;
-                case Artboard::typeKey:
+                if (!skipRuntimeObject(reader, header))
                 {
-                    Artboard* ab = object->as<Artboard>();
-                    ab->m_Factory = m_Factory;
-                    m_Artboards.push_back(std::unique_ptr<Artboard>(ab));
-                }
-                break;
-                case ImageAsset::typeKey:
-                {
-                    auto fa = object->as<FileAsset>();
-                    m_FileAssets.push_back(std::unique_ptr<FileAsset>(fa));
+                    return ImportResult::malformed;
                 }
-                break;
+                objectCount++;
             }
+            Span<const uint8_t> objects(start, reader.position() - start);
+            addLazyArtboard(object, objects, objectCount, importStack);
+            continue;
         }
-        else
+        auto result = importObject(object, importStack);
+        if (result != ImportResult::success)
         {
-            fprintf(stderr, "Failed to import object of type %d\n", object->coreType());
-            delete object;
-            continue;
+            return result;
         }
-        ImportStackObject* stackObject = nullptr;
-        auto stackType = object->coreType();
+    }
+    return ImportResult::success;
+}
+
+bool File::addLazyArtboard(Core* object,
+                           Span<const uint8_t> objects,
+                           uint32_t objectCount,
+                           ImportStack& importStack)
+{
+    if (object->import(importStack) != StatusCode::Ok)
+    {
+        fprintf(stderr, "Failed to import object of type %d\n", object->coreType());
+        delete object;
+        m_ArtboardIds.push_back(-1);
+        return false;
+    }
+    addArtboard(object->as<Artboard>());
+    m_LazyArtboards.push_back({objects, objectCount, LazyArtboard::State::unloaded});
+    m_ArtboardIds.push_back((int)m_Artboards.size() - 1);
+    return true;
+}
 
-        switch (stackType)
+void File::addArtboard(Artboard* artboard)
+{
+    artboard->m_Factory = m_Factory;
+    if (m_Artboards.size() < m_BakedTemplates.size())
+    {
+        artboard->m_Template = m_BakedTemplates[m_Artboards.size()];
+    }
+    m_Artboards.push_back(std::unique_ptr<Artboard>(artboard));
+}
+
+ImportResult File::importObject(Core* object, ImportStack& importStack)
+{
+    if (object->import(importStack) == StatusCode::Ok)
+    {
+        switch (object->coreType())
         {
             case Backboard::typeKey:
-                stackObject = new BackboardImporter(object->as<Backboard>());
+                m_Backboard.reset(object->as<Backboard>());
                 break;
             case Artboard::typeKey:
-                stackObject = new ArtboardImporter(object->as<Artboard>());
-                break;
-            case LinearAnimation::typeKey:
-                stackObject = new LinearAnimationImporter(object->as<LinearAnimation>());
-                break;
-            case KeyedObject::typeKey:
-                stackObject = new KeyedObjectImporter(object->as<KeyedObject>());
+                addArtboard(object->as<Artboard>());
                 break;
-            case KeyedProperty::typeKey:
+            case ImageAsset::typeKey:
             {
-                auto importer =
-                    importStack.latest<LinearAnimationImporter>(LinearAnimation::typeKey);
-                if (importer == nullptr)
-                {
-                    return ImportResult::malformed;
-                }
-                stackObject =
-                    new KeyedPropertyImporter(importer->animation(), object->as<KeyedProperty>());
-                break;
+                auto fa = object->as<FileAsset>();
+                m_FileAssets.push_back(std::unique_ptr<FileAsset>(fa));
             }
-            case StateMachine::typeKey:
-                stackObject = new StateMachineImporter(object->as<StateMachine>());
-                break;
-            case StateMachineLayer::typeKey:
+            break;
+        }
+    }
+    else
+    {
+        fprintf(stderr, "Failed to import object of type %d\n", object->coreType());
+        delete object;
+        return ImportResult::success;
+    }
+    ImportStackObject* stackObject = nullptr;
+    auto stackType = object->coreType();
+
+    switch (stackType)
+    {
+        case Backboard::typeKey:
+            stackObject = importStack.make<BackboardImporter>(object->as<Backboard>());
+            break;
+        case Artboard::typeKey:
+            stackObject = importStack.make<ArtboardImporter>(object->as<Artboard>());
+            break;
+        case LinearAnimation::typeKey:
+            stackObject =
+                importStack.make<LinearAnimationImporter>(object->as<LinearAnimation>());
+            break;
+        case KeyedObject::typeKey:
+            stackObject = importStack.make<KeyedObjectImporter>(object->as<KeyedObject>());
+            break;
+        case KeyedProperty::typeKey:
+        {
+            auto importer =
+                importStack.latest<LinearAnimationImporter>(LinearAnimation::typeKey);
+            if (importer == nullptr)
             {
-                auto artboardImporter = importStack.latest<ArtboardImporter>(ArtboardBase::typeKey);
-                if (artboardImporter == nullptr)
-                {
-                    return ImportResult::malformed;
-                }
+                return ImportResult::malformed;
+            }
+            stackObject = importStack.make<KeyedPropertyImporter>(importer->animation(),
+                                                                  object->as<KeyedProperty>());
+            break;
+        }
+        case StateMachine::typeKey:
+            stackObject = importStack.make<StateMachineImporter>(object->as<StateMachine>());
+            break;
+        case StateMachineLayer::typeKey:
+        {
+            auto artboardImporter = importStack.latest<ArtboardImporter>(ArtboardBase::typeKey);
+            if (artboardImporter == nullptr)
+            {
+                return ImportResult::malformed;
+            }
 
-                stackObject = new StateMachineLayerImporter(object->as<StateMachineLayer>(),
+            stackObject =
+                importStack.make<StateMachineLayerImporter>(object->as<StateMachineLayer>(),
                                                             artboardImporter->artboard());
 
-                break;
-            }
-            case EntryState::typeKey:
-            case ExitState::typeKey:
-            case AnyState::typeKey:
-            case AnimationState::typeKey:
-            case BlendState1D::typeKey:
-            case BlendStateDirect::typeKey:
-                stackObject = new LayerStateImporter(object->as<LayerState>());
-                stackType = LayerState::typeKey;
-                break;
-            case StateTransition::typeKey:
-            case BlendStateTransition::typeKey:
-                stackObject = new StateTransitionImporter(object->as<StateTransition>());
-                stackType = StateTransition::typeKey;
-                break;
-            case StateMachineListener::typeKey:
-                stackObject = new StateMachineListenerImporter(object->as<StateMachineListener>());
-                break;
-            case ImageAsset::typeKey:
-                stackObject =
-                    new FileAssetImporter(object->as<FileAsset>(), m_AssetResolver, m_Factory);
-                stackType = FileAsset::typeKey;
-                break;
+            break;
+        }
+        case EntryState::typeKey:
+        case ExitState::typeKey:
+        case AnyState::typeKey:
+        case AnimationState::typeKey:
+        case BlendState1D::typeKey:
+        case BlendStateDirect::typeKey:
+            stackObject = importStack.make<LayerStateImporter>(object->as<LayerState>());
+            stackType = LayerState::typeKey;
+            break;
+        case StateTransition::typeKey:
+        case BlendStateTransition::typeKey:
+            stackObject = importStack.make<StateTransitionImporter>(object->as<StateTransition>());
+            stackType = StateTransition::typeKey;
+            break;
+        case StateMachineListener::typeKey:
+            stackObject = importStack.make<StateMachineListenerImporter>(
+                object->as<StateMachineListener>());
+            break;
+        case ImageAsset::typeKey:
+            stackObject = importStack.make<FileAssetImporter>(object->as<FileAsset>(),
+                                                              m_AssetResolver,
+                                                              m_Factory,
+                                                              m_AssetDecoder.get());
+            stackType = FileAsset::typeKey;
+            break;
+    }
+    if (importStack.makeLatest(stackType, stackObject) != StatusCode::Ok)
+    {
+        // Some previous stack item didn't resolve.
+        return ImportResult::malformed;
+    }
+    return ImportResult::success;
+}
+
+bool File::importArtboardObjects(size_t index) const
+{
+    // Importing only adds to the artboard and the objects it owns, the rest of
+    // the file stays as it was when it was imported.
+    auto self = const_cast<File*>(this);
+    // The artboard holds itself and each of its objects.
+    m_Artboards[index]->m_Objects.reserve(m_LazyArtboards[index].objectCount + 1);
+    ImportStack importStack;
+    auto backboardImporter = importStack.make<BackboardImporter>(m_Backboard.get());
+    for (auto& asset : m_FileAssets)
+    {
+        backboardImporter->addFileAsset(asset.get());
+    }
+    BinaryReader reader(m_LazyArtboards[index].objects);
+    return importStack.makeLatest(Backboard::typeKey, backboardImporter) == StatusCode::Ok &&
+           importStack.makeLatest(Artboard::typeKey,
+                                  importStack.make<ArtboardImporter>(m_Artboards[index].get())) ==
+               StatusCode::Ok &&
+           self->readObjects(reader, *m_Header, importStack) == ImportResult::success &&
+           !reader.hasError() && importStack.resolve() == StatusCode::Ok;
+}
+
+void File::nestArtboards(size_t index) const
+{
+    // Nested artboards reference artboards by the order they're in the file,
+    // importing the artboard's objects only knew about this one.
+    for (auto nestedArtboard : m_Artboards[index]->nestedArtboards())
+    {
+        auto id = nestedArtboard->artboardId();
+        if (id >= m_ArtboardIds.size() || m_ArtboardIds[id] == -1)
+        {
+            continue;
         }
-        if (importStack.makeLatest(stackType, stackObject) != StatusCode::Ok)
+        if (auto nested = loadArtboard(m_ArtboardIds[id]))
+        {
+            nestedArtboard->nest(nested);
+        }
+    }
+}
+
+ImportResult File::loadArtboards(WorkerPool* workers)
+{
+    std::vector<uint8_t> imported(m_Artboards.size());
+    workers->parallelFor(m_Artboards.size(),
+                         [&](size_t index) { imported[index] = importArtboardObjects(index); });
+    for (size_t i = 0; i < m_Artboards.size(); i++)
+    {
+        if (!imported[i])
         {
-            // Some previous stack item didn't resolve.
             return ImportResult::malformed;
         }
+        m_LazyArtboards[i].state = LazyArtboard::State::loaded;
+    }
+    for (size_t i = 0; i < m_Artboards.size(); i++)
+    {
+        nestArtboards(i);
     }
+    return ImportResult::success;
+}
 
-    return !reader.hasError() && importStack.resolve() == StatusCode::Ok ? ImportResult::success
-                                                                         : ImportResult::malformed;
+Artboard* File::loadArtboard(size_t index) const
+{
+    if (m_LazyArtboards.empty())
+    {
+        return m_Artboards[index].get();
+    }
+    std::lock_guard<std::recursive_mutex> lock(m_LazyArtboardsMutex);
+    auto& lazy = m_LazyArtboards[index];
+    switch (lazy.state)
+    {
+        case LazyArtboard::State::loaded:
+        // An artboard nesting itself (directly or not) gets the partially
+        // loaded artboard, like it would if it was loaded eagerly.
+        case LazyArtboard::State::loading:
+            return m_Artboards[index].get();
+        case LazyArtboard::State::failed:
+            return nullptr;
+        case LazyArtboard::State::unloaded:
+            break;
+    }
+    lazy.state = LazyArtboard::State::loading;
+    if (!importArtboardObjects(index))
+    {
+        lazy.state = LazyArtboard::State::failed;
+        return nullptr;
+    }
+    nestArtboards(index);
+    lazy.state = LazyArtboard::State::loaded;
+    return m_Artboards[index].get();
 }
 
 Artboard* File::artboard(std::string name) const
 {
-    for (const auto& artboard : m_Artboards)
+    for (size_t i = 0; i < m_Artboards.size(); i++)
     {
-        if (artboard->name() == name)
+        if (m_Artboards[i]->name() == name)
         {
-            return artboard.get();
+            return loadArtboard(i);
         }
     }
     return nullptr;
@@ -309,7 +590,7 @@ Artboard* File::artboard() const
     {
         return nullptr;
     }
-    return m_Artboards[0].get();
+    return loadArtboard(0);
 }
 
 Artboard* File::artboard(size_t index) const
@@ -318,13 +599,17 @@ Artboard* File::artboard(size_t index) const
     {
         return nullptr;
     }
-    return m_Artboards[index].get();
+    return loadArtboard(index);
 }
 
 std::string File::artboardNameAt(size_t index) const
 {
-    auto ab = this->artboard(index);
-    return ab ? ab->name() : "";
+    // Names are known without loading the artboard.
+    if (index >= m_Artboards.size())
+    {
+        return "";
+    }
+    return m_Artboards[index]->name();
 }
 
 std::unique_ptr<ArtboardInstance> File::artboardDefault() const
@@ -345,6 +630,14 @@ std::unique_ptr<ArtboardInstance> File::artboardNamed(std::string name) const
     return ab ? ab->instance() : nullptr;
 }
 
+void File::waitForAssets() const
+{
+    if (m_AssetDecoder != nullptr)
+    {
+        m_AssetDecoder->wait();
+    }
+}
+
 std::vector<const FileAsset*> File::assets() const
 {
     std::vector<const FileAsset*> assets;
@@ -1,5 +1,6 @@
 #include "rive/generated/animation/animation_base.hpp"
 #include "rive/animation/animation.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* AnimationBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t AnimationBase::cloneSize() const { return sizeof(Animation); }
+
+Core* AnimationBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) Animation();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void AnimationBase::assignProperties(const Core* source)
+{
+    assign(*source->as<AnimationBase>());
+}
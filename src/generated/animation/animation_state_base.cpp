@@ -1,5 +1,6 @@
 #include "rive/generated/animation/animation_state_base.hpp"
 #include "rive/animation/animation_state.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* AnimationStateBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t AnimationStateBase::cloneSize() const { return sizeof(AnimationState); }
+
+Core* AnimationStateBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) AnimationState();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void AnimationStateBase::assignProperties(const Core* source)
+{
+    assign(*source->as<AnimationStateBase>());
+}
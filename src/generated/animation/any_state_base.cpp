@@ -1,5 +1,6 @@
 #include "rive/generated/animation/any_state_base.hpp"
 #include "rive/animation/any_state.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* AnyStateBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t AnyStateBase::cloneSize() const { return sizeof(AnyState); }
+
+Core* AnyStateBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) AnyState();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void AnyStateBase::assignProperties(const Core* source)
+{
+    assign(*source->as<AnyStateBase>());
+}
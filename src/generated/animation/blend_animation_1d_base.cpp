@@ -1,5 +1,6 @@
 #include "rive/generated/animation/blend_animation_1d_base.hpp"
 #include "rive/animation/blend_animation_1d.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* BlendAnimation1DBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t BlendAnimation1DBase::cloneSize() const { return sizeof(BlendAnimation1D); }
+
+Core* BlendAnimation1DBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) BlendAnimation1D();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void BlendAnimation1DBase::assignProperties(const Core* source)
+{
+    assign(*source->as<BlendAnimation1DBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/animation/blend_animation_direct_base.hpp"
 #include "rive/animation/blend_animation_direct.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* BlendAnimationDirectBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t BlendAnimationDirectBase::cloneSize() const { return sizeof(BlendAnimationDirect); }
+
+Core* BlendAnimationDirectBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) BlendAnimationDirect();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void BlendAnimationDirectBase::assignProperties(const Core* source)
+{
+    assign(*source->as<BlendAnimationDirectBase>());
+}
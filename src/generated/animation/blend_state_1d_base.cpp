@@ -1,5 +1,6 @@
 #include "rive/generated/animation/blend_state_1d_base.hpp"
 #include "rive/animation/blend_state_1d.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* BlendState1DBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t BlendState1DBase::cloneSize() const { return sizeof(BlendState1D); }
+
+Core* BlendState1DBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) BlendState1D();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void BlendState1DBase::assignProperties(const Core* source)
+{
+    assign(*source->as<BlendState1DBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/animation/blend_state_direct_base.hpp"
 #include "rive/animation/blend_state_direct.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* BlendStateDirectBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t BlendStateDirectBase::cloneSize() const { return sizeof(BlendStateDirect); }
+
+Core* BlendStateDirectBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) BlendStateDirect();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void BlendStateDirectBase::assignProperties(const Core* source)
+{
+    assign(*source->as<BlendStateDirectBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/animation/blend_state_transition_base.hpp"
 #include "rive/animation/blend_state_transition.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* BlendStateTransitionBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t BlendStateTransitionBase::cloneSize() const { return sizeof(BlendStateTransition); }
+
+Core* BlendStateTransitionBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) BlendStateTransition();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void BlendStateTransitionBase::assignProperties(const Core* source)
+{
+    assign(*source->as<BlendStateTransitionBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/animation/cubic_interpolator_base.hpp"
 #include "rive/animation/cubic_interpolator.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* CubicInterpolatorBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t CubicInterpolatorBase::cloneSize() const { return sizeof(CubicInterpolator); }
+
+Core* CubicInterpolatorBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) CubicInterpolator();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void CubicInterpolatorBase::assignProperties(const Core* source)
+{
+    assign(*source->as<CubicInterpolatorBase>());
+}
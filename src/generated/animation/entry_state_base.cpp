@@ -1,5 +1,6 @@
 #include "rive/generated/animation/entry_state_base.hpp"
 #include "rive/animation/entry_state.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* EntryStateBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t EntryStateBase::cloneSize() const { return sizeof(EntryState); }
+
+Core* EntryStateBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) EntryState();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void EntryStateBase::assignProperties(const Core* source)
+{
+    assign(*source->as<EntryStateBase>());
+}
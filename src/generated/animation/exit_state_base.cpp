@@ -1,5 +1,6 @@
 #include "rive/generated/animation/exit_state_base.hpp"
 #include "rive/animation/exit_state.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* ExitStateBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t ExitStateBase::cloneSize() const { return sizeof(ExitState); }
+
+Core* ExitStateBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) ExitState();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void ExitStateBase::assignProperties(const Core* source)
+{
+    assign(*source->as<ExitStateBase>());
+}
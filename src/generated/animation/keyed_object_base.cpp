@@ -1,5 +1,6 @@
 #include "rive/generated/animation/keyed_object_base.hpp"
 #include "rive/animation/keyed_object.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* KeyedObjectBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t KeyedObjectBase::cloneSize() const { return sizeof(KeyedObject); }
+
+Core* KeyedObjectBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) KeyedObject();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void KeyedObjectBase::assignProperties(const Core* source)
+{
+    assign(*source->as<KeyedObjectBase>());
+}
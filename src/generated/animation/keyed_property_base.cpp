@@ -1,5 +1,6 @@
 #include "rive/generated/animation/keyed_property_base.hpp"
 #include "rive/animation/keyed_property.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* KeyedPropertyBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t KeyedPropertyBase::cloneSize() const { return sizeof(KeyedProperty); }
+
+Core* KeyedPropertyBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) KeyedProperty();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void KeyedPropertyBase::assignProperties(const Core* source)
+{
+    assign(*source->as<KeyedPropertyBase>());
+}
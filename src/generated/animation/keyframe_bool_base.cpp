@@ -1,5 +1,6 @@
 #include "rive/generated/animation/keyframe_bool_base.hpp"
 #include "rive/animation/keyframe_bool.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* KeyFrameBoolBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t KeyFrameBoolBase::cloneSize() const { return sizeof(KeyFrameBool); }
+
+Core* KeyFrameBoolBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) KeyFrameBool();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void KeyFrameBoolBase::assignProperties(const Core* source)
+{
+    assign(*source->as<KeyFrameBoolBase>());
+}
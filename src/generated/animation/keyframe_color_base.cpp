@@ -1,5 +1,6 @@
 #include "rive/generated/animation/keyframe_color_base.hpp"
 #include "rive/animation/keyframe_color.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* KeyFrameColorBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t KeyFrameColorBase::cloneSize() const { return sizeof(KeyFrameColor); }
+
+Core* KeyFrameColorBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) KeyFrameColor();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void KeyFrameColorBase::assignProperties(const Core* source)
+{
+    assign(*source->as<KeyFrameColorBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/animation/keyframe_double_base.hpp"
 #include "rive/animation/keyframe_double.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* KeyFrameDoubleBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t KeyFrameDoubleBase::cloneSize() const { return sizeof(KeyFrameDouble); }
+
+Core* KeyFrameDoubleBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) KeyFrameDouble();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void KeyFrameDoubleBase::assignProperties(const Core* source)
+{
+    assign(*source->as<KeyFrameDoubleBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/animation/keyframe_id_base.hpp"
 #include "rive/animation/keyframe_id.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* KeyFrameIdBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t KeyFrameIdBase::cloneSize() const { return sizeof(KeyFrameId); }
+
+Core* KeyFrameIdBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) KeyFrameId();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void KeyFrameIdBase::assignProperties(const Core* source)
+{
+    assign(*source->as<KeyFrameIdBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/animation/linear_animation_base.hpp"
 #include "rive/animation/linear_animation.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* LinearAnimationBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t LinearAnimationBase::cloneSize() const { return sizeof(LinearAnimation); }
+
+Core* LinearAnimationBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) LinearAnimation();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void LinearAnimationBase::assignProperties(const Core* source)
+{
+    assign(*source->as<LinearAnimationBase>());
+}
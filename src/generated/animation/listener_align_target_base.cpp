@@ -1,5 +1,6 @@
 #include "rive/generated/animation/listener_align_target_base.hpp"
 #include "rive/animation/listener_align_target.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* ListenerAlignTargetBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t ListenerAlignTargetBase::cloneSize() const { return sizeof(ListenerAlignTarget); }
+
+Core* ListenerAlignTargetBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) ListenerAlignTarget();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void ListenerAlignTargetBase::assignProperties(const Core* source)
+{
+    assign(*source->as<ListenerAlignTargetBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/animation/listener_bool_change_base.hpp"
 #include "rive/animation/listener_bool_change.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* ListenerBoolChangeBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t ListenerBoolChangeBase::cloneSize() const { return sizeof(ListenerBoolChange); }
+
+Core* ListenerBoolChangeBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) ListenerBoolChange();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void ListenerBoolChangeBase::assignProperties(const Core* source)
+{
+    assign(*source->as<ListenerBoolChangeBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/animation/listener_number_change_base.hpp"
 #include "rive/animation/listener_number_change.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* ListenerNumberChangeBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t ListenerNumberChangeBase::cloneSize() const { return sizeof(ListenerNumberChange); }
+
+Core* ListenerNumberChangeBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) ListenerNumberChange();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void ListenerNumberChangeBase::assignProperties(const Core* source)
+{
+    assign(*source->as<ListenerNumberChangeBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/animation/listener_trigger_change_base.hpp"
 #include "rive/animation/listener_trigger_change.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* ListenerTriggerChangeBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t ListenerTriggerChangeBase::cloneSize() const { return sizeof(ListenerTriggerChange); }
+
+Core* ListenerTriggerChangeBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) ListenerTriggerChange();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void ListenerTriggerChangeBase::assignProperties(const Core* source)
+{
+    assign(*source->as<ListenerTriggerChangeBase>());
+}
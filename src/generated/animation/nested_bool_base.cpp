@@ -1,5 +1,6 @@
 #include "rive/generated/animation/nested_bool_base.hpp"
 #include "rive/animation/nested_bool.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* NestedBoolBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t NestedBoolBase::cloneSize() const { return sizeof(NestedBool); }
+
+Core* NestedBoolBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) NestedBool();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void NestedBoolBase::assignProperties(const Core* source)
+{
+    assign(*source->as<NestedBoolBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/animation/nested_number_base.hpp"
 #include "rive/animation/nested_number.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* NestedNumberBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t NestedNumberBase::cloneSize() const { return sizeof(NestedNumber); }
+
+Core* NestedNumberBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) NestedNumber();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void NestedNumberBase::assignProperties(const Core* source)
+{
+    assign(*source->as<NestedNumberBase>());
+}
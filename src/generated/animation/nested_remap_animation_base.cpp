@@ -1,5 +1,6 @@
 #include "rive/generated/animation/nested_remap_animation_base.hpp"
 #include "rive/animation/nested_remap_animation.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* NestedRemapAnimationBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t NestedRemapAnimationBase::cloneSize() const { return sizeof(NestedRemapAnimation); }
+
+Core* NestedRemapAnimationBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) NestedRemapAnimation();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void NestedRemapAnimationBase::assignProperties(const Core* source)
+{
+    assign(*source->as<NestedRemapAnimationBase>());
+}
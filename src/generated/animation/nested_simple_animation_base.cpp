@@ -1,5 +1,6 @@
 #include "rive/generated/animation/nested_simple_animation_base.hpp"
 #include "rive/animation/nested_simple_animation.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* NestedSimpleAnimationBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t NestedSimpleAnimationBase::cloneSize() const { return sizeof(NestedSimpleAnimation); }
+
+Core* NestedSimpleAnimationBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) NestedSimpleAnimation();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void NestedSimpleAnimationBase::assignProperties(const Core* source)
+{
+    assign(*source->as<NestedSimpleAnimationBase>());
+}
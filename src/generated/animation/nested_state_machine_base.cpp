@@ -1,5 +1,6 @@
 #include "rive/generated/animation/nested_state_machine_base.hpp"
 #include "rive/animation/nested_state_machine.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* NestedStateMachineBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t NestedStateMachineBase::cloneSize() const { return sizeof(NestedStateMachine); }
+
+Core* NestedStateMachineBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) NestedStateMachine();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void NestedStateMachineBase::assignProperties(const Core* source)
+{
+    assign(*source->as<NestedStateMachineBase>());
+}
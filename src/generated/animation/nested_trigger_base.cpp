@@ -1,5 +1,6 @@
 #include "rive/generated/animation/nested_trigger_base.hpp"
 #include "rive/animation/nested_trigger.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* NestedTriggerBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t NestedTriggerBase::cloneSize() const { return sizeof(NestedTrigger); }
+
+Core* NestedTriggerBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) NestedTrigger();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void NestedTriggerBase::assignProperties(const Core* source)
+{
+    assign(*source->as<NestedTriggerBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/animation/state_machine_base.hpp"
 #include "rive/animation/state_machine.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* StateMachineBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t StateMachineBase::cloneSize() const { return sizeof(StateMachine); }
+
+Core* StateMachineBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) StateMachine();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void StateMachineBase::assignProperties(const Core* source)
+{
+    assign(*source->as<StateMachineBase>());
+}
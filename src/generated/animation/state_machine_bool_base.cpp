@@ -1,5 +1,6 @@
 #include "rive/generated/animation/state_machine_bool_base.hpp"
 #include "rive/animation/state_machine_bool.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* StateMachineBoolBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t StateMachineBoolBase::cloneSize() const { return sizeof(StateMachineBool); }
+
+Core* StateMachineBoolBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) StateMachineBool();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void StateMachineBoolBase::assignProperties(const Core* source)
+{
+    assign(*source->as<StateMachineBoolBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/animation/state_machine_layer_base.hpp"
 #include "rive/animation/state_machine_layer.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* StateMachineLayerBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t StateMachineLayerBase::cloneSize() const { return sizeof(StateMachineLayer); }
+
+Core* StateMachineLayerBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) StateMachineLayer();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void StateMachineLayerBase::assignProperties(const Core* source)
+{
+    assign(*source->as<StateMachineLayerBase>());
+}
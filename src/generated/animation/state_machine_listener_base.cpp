@@ -1,5 +1,6 @@
 #include "rive/generated/animation/state_machine_listener_base.hpp"
 #include "rive/animation/state_machine_listener.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* StateMachineListenerBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t StateMachineListenerBase::cloneSize() const { return sizeof(StateMachineListener); }
+
+Core* StateMachineListenerBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) StateMachineListener();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void StateMachineListenerBase::assignProperties(const Core* source)
+{
+    assign(*source->as<StateMachineListenerBase>());
+}
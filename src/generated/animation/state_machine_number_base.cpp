@@ -1,5 +1,6 @@
 #include "rive/generated/animation/state_machine_number_base.hpp"
 #include "rive/animation/state_machine_number.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* StateMachineNumberBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t StateMachineNumberBase::cloneSize() const { return sizeof(StateMachineNumber); }
+
+Core* StateMachineNumberBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) StateMachineNumber();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void StateMachineNumberBase::assignProperties(const Core* source)
+{
+    assign(*source->as<StateMachineNumberBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/animation/state_machine_trigger_base.hpp"
 #include "rive/animation/state_machine_trigger.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* StateMachineTriggerBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t StateMachineTriggerBase::cloneSize() const { return sizeof(StateMachineTrigger); }
+
+Core* StateMachineTriggerBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) StateMachineTrigger();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void StateMachineTriggerBase::assignProperties(const Core* source)
+{
+    assign(*source->as<StateMachineTriggerBase>());
+}
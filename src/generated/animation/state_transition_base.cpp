@@ -1,5 +1,6 @@
 #include "rive/generated/animation/state_transition_base.hpp"
 #include "rive/animation/state_transition.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* StateTransitionBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t StateTransitionBase::cloneSize() const { return sizeof(StateTransition); }
+
+Core* StateTransitionBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) StateTransition();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void StateTransitionBase::assignProperties(const Core* source)
+{
+    assign(*source->as<StateTransitionBase>());
+}
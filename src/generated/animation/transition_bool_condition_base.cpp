@@ -1,5 +1,6 @@
 #include "rive/generated/animation/transition_bool_condition_base.hpp"
 #include "rive/animation/transition_bool_condition.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* TransitionBoolConditionBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t TransitionBoolConditionBase::cloneSize() const { return sizeof(TransitionBoolCondition); }
+
+Core* TransitionBoolConditionBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) TransitionBoolCondition();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void TransitionBoolConditionBase::assignProperties(const Core* source)
+{
+    assign(*source->as<TransitionBoolConditionBase>());
+}
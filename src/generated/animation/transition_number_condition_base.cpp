@@ -1,5 +1,6 @@
 #include "rive/generated/animation/transition_number_condition_base.hpp"
 #include "rive/animation/transition_number_condition.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* TransitionNumberConditionBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t TransitionNumberConditionBase::cloneSize() const { return sizeof(TransitionNumberCondition); }
+
+Core* TransitionNumberConditionBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) TransitionNumberCondition();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void TransitionNumberConditionBase::assignProperties(const Core* source)
+{
+    assign(*source->as<TransitionNumberConditionBase>());
+}
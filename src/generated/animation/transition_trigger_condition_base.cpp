@@ -1,5 +1,6 @@
 #include "rive/generated/animation/transition_trigger_condition_base.hpp"
 #include "rive/animation/transition_trigger_condition.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* TransitionTriggerConditionBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t TransitionTriggerConditionBase::cloneSize() const { return sizeof(TransitionTriggerCondition); }
+
+Core* TransitionTriggerConditionBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) TransitionTriggerCondition();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void TransitionTriggerConditionBase::assignProperties(const Core* source)
+{
+    assign(*source->as<TransitionTriggerConditionBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/artboard_base.hpp"
 #include "rive/artboard.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* ArtboardBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t ArtboardBase::cloneSize() const { return sizeof(Artboard); }
+
+Core* ArtboardBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) Artboard();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void ArtboardBase::assignProperties(const Core* source)
+{
+    assign(*source->as<ArtboardBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/assets/file_asset_contents_base.hpp"
 #include "rive/assets/file_asset_contents.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* FileAssetContentsBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t FileAssetContentsBase::cloneSize() const { return sizeof(FileAssetContents); }
+
+Core* FileAssetContentsBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) FileAssetContents();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void FileAssetContentsBase::assignProperties(const Core* source)
+{
+    assign(*source->as<FileAssetContentsBase>());
+}
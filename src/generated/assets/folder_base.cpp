@@ -1,5 +1,6 @@
 #include "rive/generated/assets/folder_base.hpp"
 #include "rive/assets/folder.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* FolderBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t FolderBase::cloneSize() const { return sizeof(Folder); }
+
+Core* FolderBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) Folder();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void FolderBase::assignProperties(const Core* source)
+{
+    assign(*source->as<FolderBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/assets/image_asset_base.hpp"
 #include "rive/assets/image_asset.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* ImageAssetBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t ImageAssetBase::cloneSize() const { return sizeof(ImageAsset); }
+
+Core* ImageAssetBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) ImageAsset();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void ImageAssetBase::assignProperties(const Core* source)
+{
+    assign(*source->as<ImageAssetBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/backboard_base.hpp"
 #include "rive/backboard.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* BackboardBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t BackboardBase::cloneSize() const { return sizeof(Backboard); }
+
+Core* BackboardBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) Backboard();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void BackboardBase::assignProperties(const Core* source)
+{
+    assign(*source->as<BackboardBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/bones/bone_base.hpp"
 #include "rive/bones/bone.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* BoneBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t BoneBase::cloneSize() const { return sizeof(Bone); }
+
+Core* BoneBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) Bone();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void BoneBase::assignProperties(const Core* source)
+{
+    assign(*source->as<BoneBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/bones/cubic_weight_base.hpp"
 #include "rive/bones/cubic_weight.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* CubicWeightBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t CubicWeightBase::cloneSize() const { return sizeof(CubicWeight); }
+
+Core* CubicWeightBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) CubicWeight();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void CubicWeightBase::assignProperties(const Core* source)
+{
+    assign(*source->as<CubicWeightBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/bones/root_bone_base.hpp"
 #include "rive/bones/root_bone.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* RootBoneBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t RootBoneBase::cloneSize() const { return sizeof(RootBone); }
+
+Core* RootBoneBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) RootBone();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void RootBoneBase::assignProperties(const Core* source)
+{
+    assign(*source->as<RootBoneBase>());
+}
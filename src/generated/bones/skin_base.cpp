@@ -1,5 +1,6 @@
 #include "rive/generated/bones/skin_base.hpp"
 #include "rive/bones/skin.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* SkinBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t SkinBase::cloneSize() const { return sizeof(Skin); }
+
+Core* SkinBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) Skin();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void SkinBase::assignProperties(const Core* source)
+{
+    assign(*source->as<SkinBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/bones/tendon_base.hpp"
 #include "rive/bones/tendon.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* TendonBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t TendonBase::cloneSize() const { return sizeof(Tendon); }
+
+Core* TendonBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) Tendon();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void TendonBase::assignProperties(const Core* source)
+{
+    assign(*source->as<TendonBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/bones/weight_base.hpp"
 #include "rive/bones/weight.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* WeightBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t WeightBase::cloneSize() const { return sizeof(Weight); }
+
+Core* WeightBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) Weight();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void WeightBase::assignProperties(const Core* source)
+{
+    assign(*source->as<WeightBase>());
+}
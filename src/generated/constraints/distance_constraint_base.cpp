@@ -1,5 +1,6 @@
 #include "rive/generated/constraints/distance_constraint_base.hpp"
 #include "rive/constraints/distance_constraint.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* DistanceConstraintBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t DistanceConstraintBase::cloneSize() const { return sizeof(DistanceConstraint); }
+
+Core* DistanceConstraintBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) DistanceConstraint();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void DistanceConstraintBase::assignProperties(const Core* source)
+{
+    assign(*source->as<DistanceConstraintBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/constraints/ik_constraint_base.hpp"
 #include "rive/constraints/ik_constraint.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* IKConstraintBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t IKConstraintBase::cloneSize() const { return sizeof(IKConstraint); }
+
+Core* IKConstraintBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) IKConstraint();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void IKConstraintBase::assignProperties(const Core* source)
+{
+    assign(*source->as<IKConstraintBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/constraints/rotation_constraint_base.hpp"
 #include "rive/constraints/rotation_constraint.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* RotationConstraintBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t RotationConstraintBase::cloneSize() const { return sizeof(RotationConstraint); }
+
+Core* RotationConstraintBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) RotationConstraint();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void RotationConstraintBase::assignProperties(const Core* source)
+{
+    assign(*source->as<RotationConstraintBase>());
+}
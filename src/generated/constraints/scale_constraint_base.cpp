@@ -1,5 +1,6 @@
 #include "rive/generated/constraints/scale_constraint_base.hpp"
 #include "rive/constraints/scale_constraint.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* ScaleConstraintBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t ScaleConstraintBase::cloneSize() const { return sizeof(ScaleConstraint); }
+
+Core* ScaleConstraintBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) ScaleConstraint();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void ScaleConstraintBase::assignProperties(const Core* source)
+{
+    assign(*source->as<ScaleConstraintBase>());
+}
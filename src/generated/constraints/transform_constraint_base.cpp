@@ -1,5 +1,6 @@
 #include "rive/generated/constraints/transform_constraint_base.hpp"
 #include "rive/constraints/transform_constraint.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* TransformConstraintBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t TransformConstraintBase::cloneSize() const { return sizeof(TransformConstraint); }
+
+Core* TransformConstraintBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) TransformConstraint();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void TransformConstraintBase::assignProperties(const Core* source)
+{
+    assign(*source->as<TransformConstraintBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/constraints/translation_constraint_base.hpp"
 #include "rive/constraints/translation_constraint.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* TranslationConstraintBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t TranslationConstraintBase::cloneSize() const { return sizeof(TranslationConstraint); }
+
+Core* TranslationConstraintBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) TranslationConstraint();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void TranslationConstraintBase::assignProperties(const Core* source)
+{
+    assign(*source->as<TranslationConstraintBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/draw_rules_base.hpp"
 #include "rive/draw_rules.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* DrawRulesBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t DrawRulesBase::cloneSize() const { return sizeof(DrawRules); }
+
+Core* DrawRulesBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) DrawRules();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void DrawRulesBase::assignProperties(const Core* source)
+{
+    assign(*source->as<DrawRulesBase>());
+}
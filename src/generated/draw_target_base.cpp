@@ -1,5 +1,6 @@
 #include "rive/generated/draw_target_base.hpp"
 #include "rive/draw_target.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* DrawTargetBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t DrawTargetBase::cloneSize() const { return sizeof(DrawTarget); }
+
+Core* DrawTargetBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) DrawTarget();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void DrawTargetBase::assignProperties(const Core* source)
+{
+    assign(*source->as<DrawTargetBase>());
+}
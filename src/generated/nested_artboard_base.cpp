@@ -1,5 +1,6 @@
 #include "rive/generated/nested_artboard_base.hpp"
 #include "rive/nested_artboard.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* NestedArtboardBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t NestedArtboardBase::cloneSize() const { return sizeof(NestedArtboard); }
+
+Core* NestedArtboardBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) NestedArtboard();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void NestedArtboardBase::assignProperties(const Core* source)
+{
+    assign(*source->as<NestedArtboardBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/node_base.hpp"
 #include "rive/node.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* NodeBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t NodeBase::cloneSize() const { return sizeof(Node); }
+
+Core* NodeBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) Node();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void NodeBase::assignProperties(const Core* source)
+{
+    assign(*source->as<NodeBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/shapes/clipping_shape_base.hpp"
 #include "rive/shapes/clipping_shape.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* ClippingShapeBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t ClippingShapeBase::cloneSize() const { return sizeof(ClippingShape); }
+
+Core* ClippingShapeBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) ClippingShape();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void ClippingShapeBase::assignProperties(const Core* source)
+{
+    assign(*source->as<ClippingShapeBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/shapes/contour_mesh_vertex_base.hpp"
 #include "rive/shapes/contour_mesh_vertex.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* ContourMeshVertexBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t ContourMeshVertexBase::cloneSize() const { return sizeof(ContourMeshVertex); }
+
+Core* ContourMeshVertexBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) ContourMeshVertex();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void ContourMeshVertexBase::assignProperties(const Core* source)
+{
+    assign(*source->as<ContourMeshVertexBase>());
+}
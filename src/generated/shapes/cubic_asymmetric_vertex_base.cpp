@@ -1,5 +1,6 @@
 #include "rive/generated/shapes/cubic_asymmetric_vertex_base.hpp"
 #include "rive/shapes/cubic_asymmetric_vertex.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* CubicAsymmetricVertexBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t CubicAsymmetricVertexBase::cloneSize() const { return sizeof(CubicAsymmetricVertex); }
+
+Core* CubicAsymmetricVertexBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) CubicAsymmetricVertex();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void CubicAsymmetricVertexBase::assignProperties(const Core* source)
+{
+    assign(*source->as<CubicAsymmetricVertexBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/shapes/cubic_detached_vertex_base.hpp"
 #include "rive/shapes/cubic_detached_vertex.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* CubicDetachedVertexBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t CubicDetachedVertexBase::cloneSize() const { return sizeof(CubicDetachedVertex); }
+
+Core* CubicDetachedVertexBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) CubicDetachedVertex();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void CubicDetachedVertexBase::assignProperties(const Core* source)
+{
+    assign(*source->as<CubicDetachedVertexBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/shapes/cubic_mirrored_vertex_base.hpp"
 #include "rive/shapes/cubic_mirrored_vertex.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* CubicMirroredVertexBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t CubicMirroredVertexBase::cloneSize() const { return sizeof(CubicMirroredVertex); }
+
+Core* CubicMirroredVertexBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) CubicMirroredVertex();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void CubicMirroredVertexBase::assignProperties(const Core* source)
+{
+    assign(*source->as<CubicMirroredVertexBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/shapes/ellipse_base.hpp"
 #include "rive/shapes/ellipse.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* EllipseBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t EllipseBase::cloneSize() const { return sizeof(Ellipse); }
+
+Core* EllipseBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) Ellipse();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void EllipseBase::assignProperties(const Core* source)
+{
+    assign(*source->as<EllipseBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/shapes/image_base.hpp"
 #include "rive/shapes/image.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* ImageBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t ImageBase::cloneSize() const { return sizeof(Image); }
+
+Core* ImageBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) Image();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void ImageBase::assignProperties(const Core* source)
+{
+    assign(*source->as<ImageBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/shapes/mesh_base.hpp"
 #include "rive/shapes/mesh.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* MeshBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t MeshBase::cloneSize() const { return sizeof(Mesh); }
+
+Core* MeshBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) Mesh();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void MeshBase::assignProperties(const Core* source)
+{
+    assign(*source->as<MeshBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/shapes/mesh_vertex_base.hpp"
 #include "rive/shapes/mesh_vertex.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* MeshVertexBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t MeshVertexBase::cloneSize() const { return sizeof(MeshVertex); }
+
+Core* MeshVertexBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) MeshVertex();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void MeshVertexBase::assignProperties(const Core* source)
+{
+    assign(*source->as<MeshVertexBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/shapes/paint/fill_base.hpp"
 #include "rive/shapes/paint/fill.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* FillBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t FillBase::cloneSize() const { return sizeof(Fill); }
+
+Core* FillBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) Fill();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void FillBase::assignProperties(const Core* source)
+{
+    assign(*source->as<FillBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/shapes/paint/gradient_stop_base.hpp"
 #include "rive/shapes/paint/gradient_stop.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* GradientStopBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t GradientStopBase::cloneSize() const { return sizeof(GradientStop); }
+
+Core* GradientStopBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) GradientStop();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void GradientStopBase::assignProperties(const Core* source)
+{
+    assign(*source->as<GradientStopBase>());
+}
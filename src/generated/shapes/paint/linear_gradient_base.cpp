@@ -1,5 +1,6 @@
 #include "rive/generated/shapes/paint/linear_gradient_base.hpp"
 #include "rive/shapes/paint/linear_gradient.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* LinearGradientBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t LinearGradientBase::cloneSize() const { return sizeof(LinearGradient); }
+
+Core* LinearGradientBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) LinearGradient();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void LinearGradientBase::assignProperties(const Core* source)
+{
+    assign(*source->as<LinearGradientBase>());
+}
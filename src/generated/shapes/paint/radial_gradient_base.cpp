@@ -1,5 +1,6 @@
 #include "rive/generated/shapes/paint/radial_gradient_base.hpp"
 #include "rive/shapes/paint/radial_gradient.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* RadialGradientBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t RadialGradientBase::cloneSize() const { return sizeof(RadialGradient); }
+
+Core* RadialGradientBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) RadialGradient();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void RadialGradientBase::assignProperties(const Core* source)
+{
+    assign(*source->as<RadialGradientBase>());
+}
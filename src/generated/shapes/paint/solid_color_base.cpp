@@ -1,5 +1,6 @@
 #include "rive/generated/shapes/paint/solid_color_base.hpp"
 #include "rive/shapes/paint/solid_color.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* SolidColorBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t SolidColorBase::cloneSize() const { return sizeof(SolidColor); }
+
+Core* SolidColorBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) SolidColor();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void SolidColorBase::assignProperties(const Core* source)
+{
+    assign(*source->as<SolidColorBase>());
+}
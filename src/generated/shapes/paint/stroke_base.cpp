@@ -1,5 +1,6 @@
 #include "rive/generated/shapes/paint/stroke_base.hpp"
 #include "rive/shapes/paint/stroke.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* StrokeBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t StrokeBase::cloneSize() const { return sizeof(Stroke); }
+
+Core* StrokeBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) Stroke();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void StrokeBase::assignProperties(const Core* source)
+{
+    assign(*source->as<StrokeBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/shapes/paint/trim_path_base.hpp"
 #include "rive/shapes/paint/trim_path.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* TrimPathBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t TrimPathBase::cloneSize() const { return sizeof(TrimPath); }
+
+Core* TrimPathBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) TrimPath();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void TrimPathBase::assignProperties(const Core* source)
+{
+    assign(*source->as<TrimPathBase>());
+}
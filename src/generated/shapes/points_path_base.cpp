@@ -1,5 +1,6 @@
 #include "rive/generated/shapes/points_path_base.hpp"
 #include "rive/shapes/points_path.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* PointsPathBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t PointsPathBase::cloneSize() const { return sizeof(PointsPath); }
+
+Core* PointsPathBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) PointsPath();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void PointsPathBase::assignProperties(const Core* source)
+{
+    assign(*source->as<PointsPathBase>());
+}
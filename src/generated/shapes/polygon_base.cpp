@@ -1,5 +1,6 @@
 #include "rive/generated/shapes/polygon_base.hpp"
 #include "rive/shapes/polygon.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* PolygonBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t PolygonBase::cloneSize() const { return sizeof(Polygon); }
+
+Core* PolygonBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) Polygon();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void PolygonBase::assignProperties(const Core* source)
+{
+    assign(*source->as<PolygonBase>());
+}
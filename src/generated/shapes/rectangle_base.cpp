@@ -1,5 +1,6 @@
 #include "rive/generated/shapes/rectangle_base.hpp"
 #include "rive/shapes/rectangle.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* RectangleBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t RectangleBase::cloneSize() const { return sizeof(Rectangle); }
+
+Core* RectangleBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) Rectangle();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void RectangleBase::assignProperties(const Core* source)
+{
+    assign(*source->as<RectangleBase>());
+}
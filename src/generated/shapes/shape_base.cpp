@@ -1,5 +1,6 @@
 #include "rive/generated/shapes/shape_base.hpp"
 #include "rive/shapes/shape.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* ShapeBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t ShapeBase::cloneSize() const { return sizeof(Shape); }
+
+Core* ShapeBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) Shape();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void ShapeBase::assignProperties(const Core* source)
+{
+    assign(*source->as<ShapeBase>());
+}
@@ -1,5 +1,6 @@
 #include "rive/generated/shapes/star_base.hpp"
 #include "rive/shapes/star.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* StarBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t StarBase::cloneSize() const { return sizeof(Star); }
+
+Core* StarBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) Star();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void StarBase::assignProperties(const Core* source)
+{
+    assign(*source->as<StarBase>());
+}
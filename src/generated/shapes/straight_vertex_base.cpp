@@ -1,5 +1,6 @@
 #include "rive/generated/shapes/straight_vertex_base.hpp"
 #include "rive/shapes/straight_vertex.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* StraightVertexBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t StraightVertexBase::cloneSize() const { return sizeof(StraightVertex); }
+
+Core* StraightVertexBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) StraightVertex();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void StraightVertexBase::assignProperties(const Core* source)
+{
+    assign(*source->as<StraightVertexBase>());
+}
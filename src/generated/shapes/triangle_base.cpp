@@ -1,5 +1,6 @@
 #include "rive/generated/shapes/triangle_base.hpp"
 #include "rive/shapes/triangle.hpp"
+#include <new>
 
 using namespace rive;
 
@@ -9,3 +10,17 @@ Core* TriangleBase::clone() const
     cloned->copy(*this);
     return cloned;
 }
+
+size_t TriangleBase::cloneSize() const { return sizeof(Triangle); }
+
+Core* TriangleBase::cloneInto(void* memory) const
+{
+    auto cloned = new (memory) Triangle();
+    cloned->copy(*this);
+    return cloned;
+}
+
+void TriangleBase::assignProperties(const Core* source)
+{
+    assign(*source->as<TriangleBase>());
+}
@@ -1,4 +1,5 @@
 #include "rive/importers/file_asset_importer.hpp"
+#include "rive/assets/asset_decoder.hpp"
 #include "rive/assets/file_asset_contents.hpp"
 #include "rive/assets/file_asset.hpp"
 #include "rive/file_asset_resolver.hpp"
@@ -9,8 +10,12 @@ using namespace rive;
 
 FileAssetImporter::FileAssetImporter(FileAsset* fileAsset,
                                      FileAssetResolver* assetResolver,
-                                     Factory* factory) :
-    m_FileAsset(fileAsset), m_FileAssetResolver(assetResolver), m_Factory(factory)
+                                     Factory* factory,
+                                     AssetDecoder* decoder) :
+    m_FileAsset(fileAsset),
+    m_FileAssetResolver(assetResolver),
+    m_Factory(factory),
+    m_Decoder(decoder)
 {}
 
 void FileAssetImporter::loadContents(std::unique_ptr<FileAssetContents> contents)
@@ -20,7 +25,14 @@ void FileAssetImporter::loadContents(std::unique_ptr<FileAssetContents> contents
     m_Content = std::move(contents);
 
     auto data = m_Content->bytes();
-    if (m_FileAsset->decode(data, m_Factory))
+    if (m_Decoder != nullptr)
+    {
+        // The file retains the bytes the contents point into. Contents that
+        // turn out not to decode aren't looked for out of band.
+        m_Decoder->decode(m_FileAsset, data);
+        m_LoadedContents = true;
+    }
+    else if (m_FileAsset->decode(data, m_Factory))
     {
         m_LoadedContents = true;
     }
@@ -32,7 +44,14 @@ StatusCode FileAssetImporter::resolve()
     {
         // Contents weren't available in-band, or they couldn't be decoded. Try
         // to find them out of band.
-        m_FileAssetResolver->loadContents(*m_FileAsset);
+        if (m_Decoder != nullptr)
+        {
+            m_FileAssetResolver->loadContentsAsync(*m_FileAsset, m_Decoder->startLoad());
+        }
+        else
+        {
+            m_FileAssetResolver->loadContents(*m_FileAsset);
+        }
     }
 
     // Note that it's ok for an asset to not resolve (or to resolve async).
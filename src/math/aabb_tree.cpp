@@ -0,0 +1,110 @@
+#include "rive/math/aabb_tree.hpp"
+#include <algorithm>
+
+using namespace rive;
+
+static bool overlaps(const AABB& a, const AABB& b)
+{
+    return a.minX <= b.maxX && b.minX <= a.maxX && a.minY <= b.maxY && b.minY <= a.maxY;
+}
+
+void AABBTree::build(Span<const AABB> boxes)
+{
+    m_Boxes.assign(boxes.begin(), boxes.end());
+    m_Nodes.clear();
+    if (m_Boxes.empty())
+    {
+        return;
+    }
+    m_Nodes.reserve(m_Boxes.size() * 2 - 1);
+
+    std::vector<uint32_t> indices(m_Boxes.size());
+    for (uint32_t i = 0; i < indices.size(); i++)
+    {
+        indices[i] = i;
+    }
+    buildNode(indices.data(), (uint32_t)indices.size());
+}
+
+uint32_t AABBTree::buildNode(uint32_t* indices, uint32_t count)
+{
+    auto index = (uint32_t)m_Nodes.size();
+    m_Nodes.push_back({AABB::forExpansion(), -1, 0});
+    if (count == 1)
+    {
+        m_Nodes[index].box = (int32_t)indices[0];
+        m_Nodes[index].bounds = m_Boxes[indices[0]];
+        return index;
+    }
+
+    // Split at the median along the axis the box centers are most spread on.
+    AABB centers = AABB::forExpansion();
+    for (uint32_t i = 0; i < count; i++)
+    {
+        AABB::expandTo(centers, m_Boxes[indices[i]].center());
+    }
+    bool splitX = centers.width() >= centers.height();
+    uint32_t half = count / 2;
+    std::nth_element(indices, indices + half, indices + count, [&](uint32_t a, uint32_t b) {
+        auto ca = m_Boxes[a].center();
+        auto cb = m_Boxes[b].center();
+        return splitX ? ca.x < cb.x : ca.y < cb.y;
+    });
+
+    auto left = buildNode(indices, half);
+    auto right = buildNode(indices + half, count - half);
+    // Children may have grown the vector, so only take the reference now.
+    auto& node = m_Nodes[index];
+    node.right = right;
+    AABB::join(node.bounds, m_Nodes[left].bounds, m_Nodes[right].bounds);
+    return index;
+}
+
+void AABBTree::refit()
+{
+    // Children always come after their parent, walking backwards visits them
+    // first.
+    for (size_t i = m_Nodes.size(); i-- > 0;)
+    {
+        auto& node = m_Nodes[i];
+        if (node.box >= 0)
+        {
+            node.bounds = m_Boxes[node.box];
+        }
+        else
+        {
+            AABB::join(node.bounds, m_Nodes[i + 1].bounds, m_Nodes[node.right].bounds);
+        }
+    }
+}
+
+void AABBTree::query(const AABB& area, std::vector<uint32_t>& results) const
+{
+    results.clear();
+    if (m_Nodes.empty())
+    {
+        return;
+    }
+    // Median splits keep the depth at log2 of the box count.
+    uint32_t stack[64];
+    int stackSize = 0;
+    stack[stackSize++] = 0;
+    while (stackSize != 0)
+    {
+        auto index = stack[--stackSize];
+        auto& node = m_Nodes[index];
+        if (!overlaps(node.bounds, area))
+        {
+            continue;
+        }
+        if (node.box >= 0)
+        {
+            results.push_back((uint32_t)node.box);
+        }
+        else
+        {
+            stack[stackSize++] = node.right;
+            stack[stackSize++] = index + 1;
+        }
+    }
+}
@@ -373,15 +373,17 @@ void ContourMeasureIter::reset(const RawPath& path, float tolerance)
     m_invTolerance = 1.0f / std::max(tolerance, kMinTolerance);
 }
 
-// Can return null if either it encountered an empty contour (length == 0)
-// or the iterator is exhausted.
+// Fills segs and pts (which must be empty) with the next contour. Can return
+// false if either it encountered an empty contour (length == 0) or the
+// iterator is exhausted.
 //
-rcp<ContourMeasure> ContourMeasureIter::tryNext()
+bool ContourMeasureIter::tryNext(std::vector<ContourMeasure::Segment>& segs,
+                                 std::vector<Vec2D>& pts,
+                                 float& distance,
+                                 bool& isClosed)
 {
-    std::vector<ContourMeasure::Segment> segs;
-    std::vector<Vec2D> pts;
-    float distance = 0;
-    bool isClosed = false;
+    distance = 0;
+    isClosed = false;
 
     for (; m_iter != m_end; ++m_iter)
     {
@@ -443,27 +445,43 @@ rcp<ContourMeasure> ContourMeasureIter::tryNext()
         }
     }
 
-    if (distance == 0 || pts.size() < 2)
-    {
-        return nullptr;
-    }
-    return rcp<ContourMeasure>(
-        new ContourMeasure(std::move(segs), std::move(pts), distance, isClosed));
+    return distance != 0 && pts.size() >= 2;
 }
 
-rcp<ContourMeasure> ContourMeasureIter::next()
+rcp<ContourMeasure> ContourMeasureIter::next() { return this->next(nullptr); }
+
+rcp<ContourMeasure> ContourMeasureIter::next(rcp<ContourMeasure> reuse)
 {
-    rcp<ContourMeasure> cm;
+    std::vector<ContourMeasure::Segment> segs;
+    std::vector<Vec2D> pts;
+    const bool recycle = reuse != nullptr && reuse->unique();
+    if (recycle)
+    {
+        segs.swap(reuse->m_segments);
+        pts.swap(reuse->m_points);
+    }
     for (;;)
     {
-        if ((cm = this->tryNext()))
+        segs.clear();
+        pts.clear();
+        float distance;
+        bool isClosed;
+        if (this->tryNext(segs, pts, distance, isClosed))
         {
-            break;
+            if (recycle)
+            {
+                reuse->m_segments.swap(segs);
+                reuse->m_points.swap(pts);
+                reuse->m_length = distance;
+                reuse->m_isClosed = isClosed;
+                return reuse;
+            }
+            return rcp<ContourMeasure>(
+                new ContourMeasure(std::move(segs), std::move(pts), distance, isClosed));
         }
         if (m_iter == m_end)
         {
-            break;
+            return nullptr;
         }
     }
-    return cm;
 }
@@ -12,9 +12,16 @@ using namespace rive;
 NestedArtboard::NestedArtboard() {}
 NestedArtboard::~NestedArtboard() {}
 
-Core* NestedArtboard::clone() const
+Core* NestedArtboard::clone() const { return finishClone(NestedArtboardBase::clone()); }
+
+Core* NestedArtboard::cloneInto(void* memory) const
+{
+    return finishClone(NestedArtboardBase::cloneInto(memory));
+}
+
+Core* NestedArtboard::finishClone(Core* clone) const
 {
-    NestedArtboard* nestedArtboard = static_cast<NestedArtboard*>(NestedArtboardBase::clone());
+    NestedArtboard* nestedArtboard = static_cast<NestedArtboard*>(clone);
     if (m_Artboard == nullptr)
     {
         return nestedArtboard;
@@ -45,6 +52,22 @@ void NestedArtboard::nest(Artboard* artboard)
     m_Artboard->advance(0.0f);
 }
 
+void NestedArtboard::reset(const NestedArtboard* source)
+{
+    if (m_Instance == nullptr || source->m_Artboard == nullptr ||
+        !source->m_Artboard->resetInstance(m_Instance.get()))
+    {
+        return;
+    }
+    m_Artboard->frameOrigin(false);
+    m_Artboard->opacity(renderOpacity());
+    for (auto animation : m_NestedAnimations)
+    {
+        animation->initializeAnimation(m_Instance.get());
+    }
+    m_Artboard->advance(0.0f);
+}
+
 static Mat2D makeTranslate(const Artboard* artboard)
 {
     return Mat2D::fromTranslate(-artboard->originX() * artboard->width(),
@@ -0,0 +1,73 @@
+#include "rive/scene_scheduler.hpp"
+#include "rive/scene.hpp"
+#include "rive/worker_pool.hpp"
+#include <algorithm>
+
+using namespace rive;
+
+SceneScheduler::SceneScheduler(WorkerPool* workers) : m_Workers(workers) {}
+
+void SceneScheduler::add(Scene* scene, float elapsedSeconds)
+{
+    m_Entries.push_back({scene, elapsedSeconds});
+    m_NeedsDraw.push_back(0);
+    // Grouped again on the next advanceAndApply.
+    m_GroupStarts.clear();
+}
+
+void SceneScheduler::elapsedSeconds(size_t index, float value)
+{
+    m_Entries[index].elapsedSeconds = value;
+}
+
+void SceneScheduler::clear()
+{
+    m_Entries.clear();
+    m_NeedsDraw.clear();
+    m_GroupStarts.clear();
+}
+
+void SceneScheduler::advanceAndApply()
+{
+    auto count = (uint32_t)m_Entries.size();
+    if (m_GroupStarts.empty() && count != 0)
+    {
+        m_Order.resize(count);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            m_Order[i] = i;
+        }
+        // Stable so an instance's scenes stay in the order they were added.
+        std::stable_sort(m_Order.begin(), m_Order.end(), [this](uint32_t a, uint32_t b) {
+            return m_Entries[a].scene->artboardInstance() <
+                   m_Entries[b].scene->artboardInstance();
+        });
+        for (uint32_t i = 0; i < count; i++)
+        {
+            if (i == 0 || m_Entries[m_Order[i]].scene->artboardInstance() !=
+                              m_Entries[m_Order[i - 1]].scene->artboardInstance())
+            {
+                m_GroupStarts.push_back(i);
+            }
+        }
+        m_GroupStarts.push_back(count);
+    }
+
+    auto groupCount = m_GroupStarts.empty() ? 0 : m_GroupStarts.size() - 1;
+    auto advanceGroup = [this](size_t group) {
+        for (auto i = m_GroupStarts[group]; i < m_GroupStarts[group + 1]; i++)
+        {
+            auto& entry = m_Entries[m_Order[i]];
+            m_NeedsDraw[m_Order[i]] = entry.scene->advanceAndApply(entry.elapsedSeconds);
+        }
+    };
+    if (m_Workers == nullptr)
+    {
+        for (size_t group = 0; group < groupCount; group++)
+        {
+            advanceGroup(group);
+        }
+        return;
+    }
+    m_Workers->parallelFor(groupCount, advanceGroup);
+}
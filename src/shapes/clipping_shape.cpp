@@ -14,45 +14,38 @@ StatusCode ClippingShape::onAddedClean(CoreContext* context)
     auto clippingHolder = parent();
 
     auto artboard = static_cast<Artboard*>(context);
-    for (auto core : artboard->objects())
+    auto& objects = artboard->objects();
+    std::vector<uint32_t> ids;
+
+    // Find drawables that are parented to this clipping shape, they need to
+    // know they'll be clipped by this shape.
+    if (clippingHolder != nullptr)
     {
-        if (core == nullptr)
-        {
-            continue;
-        }
-        // Iterate artboard to find drawables that are parented to this clipping
-        // shape, they need to know they'll be clipped by this shape.
-        if (core->is<Drawable>())
+        artboard->subtreeIds(parentId(), ids);
+    }
+    for (auto id : ids)
+    {
+        if (objects[id]->is<Drawable>())
         {
-            auto drawable = core->as<Drawable>();
-            for (ContainerComponent* component = drawable; component != nullptr;
-                 component = component->parent())
-            {
-                if (component == clippingHolder)
-                {
-                    drawable->addClippingShape(this);
-                    break;
-                }
-            }
+            objects[id]->as<Drawable>()->addClippingShape(this);
         }
+    }
 
-        // Iterate artboard to find shapes that are parented to the source,
-        // their paths will need to be RenderPaths in order to be used for
-        // clipping operations.
+    // Find shapes that are parented to the source, their paths will need to
+    // be RenderPaths in order to be used for clipping operations.
+    ids.clear();
+    if (m_Source != nullptr)
+    {
+        artboard->subtreeIds(sourceId(), ids);
+    }
+    for (auto id : ids)
+    {
+        auto core = objects[id];
         if (core->is<Shape>() && core != clippingHolder)
         {
-            auto component = core->as<ContainerComponent>();
-            while (component != nullptr)
-            {
-                if (component == m_Source)
-                {
-                    auto shape = core->as<Shape>();
-                    shape->addDefaultPathSpace(PathSpace::World | PathSpace::Clipping);
-                    m_Shapes.push_back(shape);
-                    break;
-                }
-                component = component->parent();
-            }
+            auto shape = core->as<Shape>();
+            shape->addDefaultPathSpace(PathSpace::World | PathSpace::Clipping);
+            m_Shapes.push_back(shape);
         }
     }
 
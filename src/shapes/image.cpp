@@ -46,7 +46,11 @@ Core* Image::hitTest(HitInfo* hinfo, const Mat2D& xform)
 {
     // TODO: handle clip?
 
-    auto renderImage = m_ImageAsset->renderImage();
+    RenderImage* renderImage;
+    if (m_ImageAsset == nullptr || (renderImage = m_ImageAsset->renderImage()) == nullptr)
+    {
+        return nullptr;
+    }
     int width = renderImage->width();
     int height = renderImage->height();
 
@@ -100,9 +104,13 @@ void Image::assets(const std::vector<FileAsset*>& assets)
     }
 }
 
-Core* Image::clone() const
+Core* Image::clone() const { return finishClone(ImageBase::clone()); }
+
+Core* Image::cloneInto(void* memory) const { return finishClone(ImageBase::cloneInto(memory)); }
+
+Core* Image::finishClone(Core* clone) const
 {
-    Image* twin = ImageBase::clone()->as<Image>();
+    Image* twin = clone->as<Image>();
     twin->m_ImageAsset = m_ImageAsset;
     return twin;
 }
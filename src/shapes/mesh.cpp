@@ -69,10 +69,7 @@ void Mesh::decodeTriangleIndexBytes(Span<const uint8_t> value)
     rcp<IndexBuffer> buffer = rcp<IndexBuffer>(new IndexBuffer());
 
     BinaryReader reader(value);
-    while (!reader.reachedEnd())
-    {
-        buffer->push_back(reader.readVarUintAs<uint16_t>());
-    }
+    reader.readVarUint16s(*buffer);
     m_IndexBuffer = buffer;
 }
 
@@ -84,17 +81,21 @@ void Mesh::copyTriangleIndexBytes(const MeshBase& object)
 /// Called whenever a bone moves that is connected to the skin.
 void Mesh::markSkinDirty() { addDirt(ComponentDirt::Vertices); }
 
-Core* Mesh::clone() const
+Core* Mesh::clone() const { return finishClone(MeshBase::clone()); }
+
+Core* Mesh::cloneInto(void* memory) const { return finishClone(MeshBase::cloneInto(memory)); }
+
+Core* Mesh::finishClone(Core* object) const
 {
-    auto clone = static_cast<Mesh*>(MeshBase::clone());
+    auto clone = static_cast<Mesh*>(object);
     clone->m_UVRenderBuffer = m_UVRenderBuffer;
     clone->m_IndexRenderBuffer = m_IndexRenderBuffer;
     return clone;
 }
 
-void Mesh::initializeSharedBuffers(RenderImage* renderImage)
+rcp<RenderBuffer> Mesh::makeUVRenderBuffer(const RenderImage* renderImage) const
 {
-    Mat2D uvTransform = renderImage != nullptr ? renderImage->uvTransform() : Mat2D();
+    const Mat2D& uvTransform = renderImage->uvTransform();
 
     std::vector<float> uv = std::vector<float>(m_Vertices.size() * 2);
     std::size_t index = 0;
@@ -106,9 +107,16 @@ void Mesh::initializeSharedBuffers(RenderImage* renderImage)
         uv[index++] = xformedUV.y;
     }
 
-    auto factory = artboard()->factory();
-    m_UVRenderBuffer = factory->makeBufferF32(uv);
-    m_IndexRenderBuffer = factory->makeBufferU16(*m_IndexBuffer);
+    return artboard()->factory()->makeBufferF32(uv);
+}
+
+void Mesh::initializeSharedBuffers(RenderImage* renderImage)
+{
+    if (renderImage != nullptr)
+    {
+        m_UVRenderBuffer = makeUVRenderBuffer(renderImage);
+    }
+    m_IndexRenderBuffer = artboard()->factory()->makeBufferU16(*m_IndexBuffer);
 }
 
 void Mesh::buildDependencies()
@@ -138,18 +146,23 @@ void Mesh::draw(Renderer* renderer, const RenderImage* image, BlendMode blendMod
 {
     if (m_VertexRenderBuffer == nullptr)
     {
-
-        std::vector<float> vertices(m_Vertices.size() * 2);
+        m_VertexStorage.resize(m_Vertices.size() * 2);
         std::size_t index = 0;
         for (auto vertex : m_Vertices)
         {
             auto translation = vertex->renderTranslation();
-            vertices[index++] = translation.x;
-            vertices[index++] = translation.y;
+            m_VertexStorage[index++] = translation.x;
+            m_VertexStorage[index++] = translation.y;
         }
 
         auto factory = artboard()->factory();
-        m_VertexRenderBuffer = factory->makeBufferF32(vertices);
+        m_VertexRenderBuffer = factory->makeBufferF32(m_VertexStorage);
+    }
+
+    if (m_UVRenderBuffer == nullptr)
+    {
+        // The image was decoded after the mesh was initialized.
+        m_UVRenderBuffer = makeUVRenderBuffer(image);
     }
 
     if (skin() == nullptr)
@@ -10,8 +10,8 @@ using namespace rive;
 void MetricsPath::reset()
 {
     m_Paths.clear();
-    m_Contour.reset(nullptr);
-    m_RawPath = RawPath();
+    m_HasContour = false;
+    m_RawPath.rewind();
     m_ComputedLengthTransform = Mat2D();
     m_ComputedLength = 0;
 }
@@ -44,11 +44,15 @@ void MetricsPath::close()
 float MetricsPath::computeLength(const Mat2D& transform)
 {
     // Only compute if our pre-computed length is not valid
-    if (!m_Contour || transform != m_ComputedLengthTransform)
+    if (!m_HasContour || transform != m_ComputedLengthTransform)
     {
         m_ComputedLengthTransform = transform;
-        m_Contour = ContourMeasureIter(m_RawPath * transform).next();
-        m_ComputedLength = m_Contour ? m_Contour->length() : 0;
+        // Copying into the scratch path reuses its storage.
+        m_TransformedPath = m_RawPath;
+        m_TransformedPath.transformInPlace(transform);
+        m_Contour = ContourMeasureIter(m_TransformedPath).next(std::move(m_Contour));
+        m_HasContour = m_Contour != nullptr;
+        m_ComputedLength = m_HasContour ? m_Contour->length() : 0;
     }
     return m_ComputedLength;
 }
@@ -63,11 +67,11 @@ void MetricsPath::trim(float startLength, float endLength, bool moveTo, RenderPa
     }
 
     // TODO: if we can change the signature of MetricsPath and/or trim() to speak native
-    //       rawpaths, we wouldn't need this temporary copy (since ContourMeasure speaks
-    //       native rawpaths).
-    RawPath tmp;
-    m_Contour->getSegment(startLength, endLength, &tmp, moveTo);
-    tmp.addTo(result);
+    //       rawpaths, we wouldn't need this copy (since ContourMeasure speaks native
+    //       rawpaths).
+    m_TrimmedPath.rewind();
+    m_Contour->getSegment(startLength, endLength, &m_TrimmedPath, moveTo);
+    m_TrimmedPath.addTo(result);
 }
 
 RenderMetricsPath::RenderMetricsPath(std::unique_ptr<RenderPath> path) :
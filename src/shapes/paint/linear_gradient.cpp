@@ -28,6 +28,16 @@ StatusCode LinearGradient::onAddedDirty(CoreContext* context)
 }
 
 void LinearGradient::buildDependencies()
+{
+    auto p = parent();
+    if (p != nullptr && p->parent() != nullptr)
+    {
+        // Update after the shape paint container that owns our paint.
+        p->parent()->addDependent(this);
+    }
+}
+
+void LinearGradient::onResolved()
 {
     auto p = parent();
     if (p != nullptr && p->parent() != nullptr)
@@ -41,7 +51,6 @@ void LinearGradient::buildDependencies()
         // doing the transform to world in update. If it's the artboard, then
         // we're already in world so no need to transform.
         m_ShapePaintContainer = parentsParent->is<Node>() ? parentsParent->as<Node>() : nullptr;
-        parentsParent->addDependent(this);
     }
 }
 
@@ -91,10 +100,11 @@ void LinearGradient::update(ComponentDirt value)
         const auto ro = opacity() * renderOpacity();
         const auto count = m_Stops.size();
 
-        // need some temporary storage. Allocate enough for both arrays
+        // need some temporary storage. Make room for both arrays, kept
+        // between updates so rebuilding the gradient doesn't allocate.
         assert(sizeof(ColorInt) == sizeof(float));
-        std::vector<ColorInt> storage(count * 2);
-        ColorInt* colors = storage.data();
+        m_Storage.resize(count * 2);
+        ColorInt* colors = m_Storage.data();
         float* stops = (float*)colors + count;
 
         for (size_t i = 0; i < count; ++i)
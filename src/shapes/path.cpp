@@ -47,12 +47,12 @@ StatusCode Path::onAddedClean(CoreContext* context)
     return StatusCode::MissingObject;
 }
 
-void Path::buildDependencies()
+void Path::onResolved()
 {
-    Super::buildDependencies();
+    Super::onResolved();
     // Make sure this is called once the shape has all of the paints added
-    // (paints get added during the added cycle so buildDependencies is a good
-    // time to do this.)
+    // (paints get added during the added cycle so onResolved is a good time
+    // to do this.)
     m_CommandPath = m_Shape->makeCommandPath(PathSpace::Neither);
 }
 
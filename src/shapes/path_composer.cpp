@@ -24,6 +24,7 @@ void PathComposer::update(ComponentDirt value)
 {
     if (hasDirt(value, ComponentDirt::Path))
     {
+        m_Version++;
         auto space = m_Shape->pathSpace();
         if ((space & PathSpace::Local) == PathSpace::Local)
         {
@@ -80,6 +80,51 @@ bool Shape::hitTest(const IAABB& area) const
     return tester.wasHit();
 }
 
+namespace
+{
+/// Collects the bounds of the points a path is built from.
+class BoundsCommandPath : public CommandPath
+{
+    Mat2D m_Xform;
+
+public:
+    AABB bounds = AABB::forExpansion();
+
+    void setXform(const Mat2D& xform) { m_Xform = xform; }
+
+    void reset() override { bounds = AABB::forExpansion(); }
+    void fillRule(FillRule value) override {}
+    void addPath(CommandPath* path, const Mat2D& transform) override { assert(false); }
+    RenderPath* renderPath() override
+    {
+        assert(false);
+        return nullptr;
+    }
+
+    void moveTo(float x, float y) override { AABB::expandTo(bounds, m_Xform * Vec2D(x, y)); }
+    void lineTo(float x, float y) override { AABB::expandTo(bounds, m_Xform * Vec2D(x, y)); }
+    void cubicTo(float ox, float oy, float ix, float iy, float x, float y) override
+    {
+        // A cubic is contained by its control points.
+        AABB::expandTo(bounds, m_Xform * Vec2D(ox, oy));
+        AABB::expandTo(bounds, m_Xform * Vec2D(ix, iy));
+        AABB::expandTo(bounds, m_Xform * Vec2D(x, y));
+    }
+    void close() override {}
+};
+} // namespace
+
+AABB Shape::computeWorldBounds() const
+{
+    BoundsCommandPath boundsPath;
+    for (auto path : m_Paths)
+    {
+        boundsPath.setXform(path->pathTransform());
+        path->buildPath(boundsPath);
+    }
+    return boundsPath.bounds;
+}
+
 Core* Shape::hitTest(HitInfo* hinfo, const Mat2D& xform)
 {
     if (renderOpacity() == 0.0f)
@@ -140,6 +185,11 @@ void Shape::buildDependencies()
     m_PathComposer.buildDependencies();
 
     Super::buildDependencies();
+}
+
+void Shape::onResolved()
+{
+    Super::onResolved();
 
     // Set the blend mode on all the shape paints. If we ever animate this
     // property, we'll need to update it in the update cycle/mark dirty when the
@@ -0,0 +1,182 @@
+#include "rive/streaming_file_importer.hpp"
+#include "rive/runtime_header.hpp"
+#include "rive/core/binary_reader.hpp"
+#include "rive/importers/import_stack.hpp"
+
+using namespace rive;
+
+StreamingFileImporter::StreamingFileImporter(Factory* factory, FileAssetResolver* assetResolver) :
+    m_Factory(factory), m_AssetResolver(assetResolver), m_ImportStack(new ImportStack())
+{}
+
+StreamingFileImporter::~StreamingFileImporter() { delete m_Artboard; }
+
+ImportResult StreamingFileImporter::append(Span<const uint8_t> chunk)
+{
+    if (m_Result != ImportResult::success)
+    {
+        return m_Result;
+    }
+    m_Pending.insert(m_Pending.end(), chunk.begin(), chunk.end());
+    return m_Result = importPending(false);
+}
+
+std::unique_ptr<File> StreamingFileImporter::finish(ImportResult* result)
+{
+    if (m_Result == ImportResult::success)
+    {
+        m_Result = importPending(true);
+    }
+    if (m_Result == ImportResult::success &&
+        (m_File == nullptr || m_ImportStack->resolve() != StatusCode::Ok))
+    {
+        m_Result = ImportResult::malformed;
+    }
+    if (result)
+    {
+        *result = m_Result;
+    }
+    if (m_Result != ImportResult::success)
+    {
+        return nullptr;
+    }
+    for (size_t i = 0; i < m_File->m_Artboards.size(); i++)
+    {
+        m_File->nestArtboards(i);
+    }
+    return std::move(m_File);
+}
+
+ImportResult StreamingFileImporter::importPending(bool finished)
+{
+    if (m_File == nullptr)
+    {
+        BinaryReader reader(m_Pending);
+        RuntimeHeader header;
+        if (!RuntimeHeader::read(reader, header))
+        {
+            return reader.didOverflow() && !finished ? ImportResult::success
+                                                     : ImportResult::malformed;
+        }
+        if (header.majorVersion() != File::majorVersion)
+        {
+            fprintf(stderr,
+                    "Unsupported version %u.%u expected %u.%u.\n",
+                    header.majorVersion(),
+                    header.minorVersion(),
+                    File::majorVersion,
+                    File::minorVersion);
+            return ImportResult::unsupportedVersion;
+        }
+        m_File.reset(new File(m_Factory, m_AssetResolver));
+        m_File->m_ArtboardLoading = ArtboardLoading::lazy;
+        m_File->m_Header = std::make_unique<RuntimeHeader>(header);
+        m_Read = reader.position() - m_Pending.data();
+    }
+
+    const RuntimeHeader& header = *m_File->m_Header;
+    while (true)
+    {
+        Span<const uint8_t> remaining(m_Pending.data() + m_Read, m_Pending.size() - m_Read);
+        if (remaining.empty())
+        {
+            if (finished && m_Artboard != nullptr)
+            {
+                return completeArtboard();
+            }
+            break;
+        }
+
+        if (m_Artboard != nullptr)
+        {
+            // The artboard is complete once the next object belongs to the
+            // file.
+            BinaryReader typeReader(remaining);
+            auto typeKey = typeReader.readVarUint64();
+            if (typeReader.didOverflow())
+            {
+                return finished ? ImportResult::malformed : ImportResult::success;
+            }
+            if (File::isFileObject(typeKey))
+            {
+                auto result = completeArtboard();
+                if (result != ImportResult::success)
+                {
+                    return result;
+                }
+                continue;
+            }
+        }
+
+        // Only objects that have been received in full are read.
+        BinaryReader reader(remaining);
+        if (!File::skipRuntimeObject(reader, header))
+        {
+            return reader.didOverflow() && !finished ? ImportResult::success
+                                                     : ImportResult::malformed;
+        }
+        size_t size = reader.position() - remaining.data();
+        m_Read += size;
+        if (m_Artboard != nullptr)
+        {
+            // Part of the artboard, imported once the artboard is complete.
+            m_ArtboardObjectCount++;
+            continue;
+        }
+
+        BinaryReader objectReader(Span<const uint8_t>(remaining.data(), size));
+        auto object = File::readRuntimeObject(objectReader, header);
+        if (object == nullptr)
+        {
+            m_ImportStack->readNullObject();
+        }
+        else if (object->is<Artboard>())
+        {
+            // The artboard's objects follow it, keep them from the start of
+            // the pending bytes.
+            m_Artboard = object;
+            m_ArtboardObjectCount = 0;
+            m_Pending.erase(m_Pending.begin(), m_Pending.begin() + m_Read);
+            m_Read = 0;
+        }
+        else
+        {
+            // Objects are done with the bytes they're read from once they're
+            // imported (in-band asset contents are decoded right away).
+            auto result = m_File->importObject(object, *m_ImportStack);
+            if (result != ImportResult::success)
+            {
+                return result;
+            }
+        }
+    }
+    if (m_Artboard == nullptr)
+    {
+        m_Pending.erase(m_Pending.begin(), m_Pending.begin() + m_Read);
+        m_Read = 0;
+    }
+    return ImportResult::success;
+}
+
+ImportResult StreamingFileImporter::completeArtboard()
+{
+    auto artboard = m_Artboard;
+    m_Artboard = nullptr;
+    Span<const uint8_t> objects(m_Pending.data(), m_Read);
+    if (m_File->addLazyArtboard(artboard, objects, m_ArtboardObjectCount, *m_ImportStack))
+    {
+        size_t index = m_File->m_Artboards.size() - 1;
+        auto& lazy = m_File->m_LazyArtboards[index];
+        if (!m_File->importArtboardObjects(index))
+        {
+            return ImportResult::malformed;
+        }
+        // The bytes are about to go away, but they're not needed anymore.
+        lazy.state = File::LazyArtboard::State::loaded;
+        lazy.objects = Span<const uint8_t>();
+        m_File->nestArtboards(index);
+    }
+    m_Pending.erase(m_Pending.begin(), m_Pending.begin() + m_Read);
+    m_Read = 0;
+    return ImportResult::success;
+}
@@ -0,0 +1,128 @@
+#include "rive/worker_pool.hpp"
+
+using namespace rive;
+
+// Set while a thread is running work, nested parallelFor calls run serially
+// rather than waiting on workers that may be busy waiting on them.
+static thread_local bool tl_InWork = false;
+
+WorkerPool::WorkerPool(size_t threadCount)
+{
+    if (threadCount == 0)
+    {
+        threadCount = std::thread::hardware_concurrency();
+    }
+    for (size_t i = 1; i < threadCount; i++)
+    {
+        m_Threads.emplace_back(&WorkerPool::workerMain, this);
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Exiting = true;
+    }
+    m_WorkReady.notify_all();
+    for (auto& thread : m_Threads)
+    {
+        thread.join();
+    }
+}
+
+void WorkerPool::parallelFor(size_t count, Work work, void* context)
+{
+    if (m_Threads.empty() || count < 2 || tl_InWork)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            work(context, i);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> parallelForLock(m_ParallelForMutex);
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Work = work;
+        m_Context = context;
+        m_Count = count;
+        m_NextIndex = 0;
+        m_Generation++;
+    }
+    m_WorkReady.notify_all();
+    runWork(work, context, count);
+
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_WorkDone.wait(lock, [this] { return m_Busy == 0; });
+    // Workers that wake up from here on have missed this work.
+    m_Work = nullptr;
+}
+
+void WorkerPool::submit(Task task, void* context)
+{
+    if (m_Threads.empty())
+    {
+        task(context);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Tasks.emplace_back(task, context);
+    }
+    m_WorkReady.notify_one();
+}
+
+void WorkerPool::runWork(Work work, void* context, size_t count)
+{
+    tl_InWork = true;
+    for (size_t index; (index = m_NextIndex.fetch_add(1)) < count;)
+    {
+        work(context, index);
+    }
+    tl_InWork = false;
+}
+
+void WorkerPool::workerMain()
+{
+    uint64_t generation = 0;
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (true)
+    {
+        m_WorkReady.wait(lock, [&] {
+            return m_Exiting || m_Generation != generation || !m_Tasks.empty();
+        });
+        if (m_Generation == generation)
+        {
+            if (m_Tasks.empty())
+            {
+                return;
+            }
+            auto task = m_Tasks.front();
+            m_Tasks.pop_front();
+            lock.unlock();
+            tl_InWork = true;
+            task.first(task.second);
+            tl_InWork = false;
+            lock.lock();
+            continue;
+        }
+        generation = m_Generation;
+        if (m_Work == nullptr)
+        {
+            continue;
+        }
+        auto work = m_Work;
+        auto context = m_Context;
+        auto count = m_Count;
+        m_Busy++;
+        lock.unlock();
+        runWork(work, context, count);
+        lock.lock();
+        if (--m_Busy == 0)
+        {
+            m_WorkDone.notify_all();
+        }
+    }
+}
@@ -0,0 +1,80 @@
+#include <rive/math/aabb_tree.hpp>
+#include <catch.hpp>
+#include <algorithm>
+#include <cstdlib>
+
+static float randomFloat(float range) { return (float)rand() / (float)RAND_MAX * range; }
+
+static rive::AABB randomBox()
+{
+    float x = randomFloat(1000.0f);
+    float y = randomFloat(1000.0f);
+    return rive::AABB(x, y, x + randomFloat(50.0f), y + randomFloat(50.0f));
+}
+
+static std::vector<uint32_t> bruteForce(const std::vector<rive::AABB>& boxes,
+                                        const rive::AABB& area)
+{
+    std::vector<uint32_t> results;
+    for (uint32_t i = 0; i < boxes.size(); i++)
+    {
+        auto& box = boxes[i];
+        if (box.minX <= area.maxX && area.minX <= box.maxX && box.minY <= area.maxY &&
+            area.minY <= box.maxY)
+        {
+            results.push_back(i);
+        }
+    }
+    return results;
+}
+
+static void checkQueries(const rive::AABBTree& tree, const std::vector<rive::AABB>& boxes)
+{
+    std::vector<uint32_t> results;
+    for (int i = 0; i < 200; i++)
+    {
+        auto area = randomBox();
+        tree.query(area, results);
+        std::sort(results.begin(), results.end());
+        REQUIRE(results == bruteForce(boxes, area));
+    }
+}
+
+TEST_CASE("aabb tree queries match brute force", "[aabb]")
+{
+    srand(7);
+    for (size_t count : {0, 1, 2, 3, 17, 500})
+    {
+        std::vector<rive::AABB> boxes;
+        for (size_t i = 0; i < count; i++)
+        {
+            boxes.push_back(randomBox());
+        }
+        rive::AABBTree tree;
+        tree.build(boxes);
+        REQUIRE(tree.size() == count);
+        checkQueries(tree, boxes);
+
+        // Move some of the boxes and refit.
+        for (size_t i = 0; i < count; i += 3)
+        {
+            boxes[i] = randomBox();
+            tree.update(i, boxes[i]);
+        }
+        tree.refit();
+        checkQueries(tree, boxes);
+    }
+}
+
+TEST_CASE("aabb tree skips empty boxes", "[aabb]")
+{
+    std::vector<rive::AABB> boxes = {rive::AABB::forExpansion(), rive::AABB(0, 0, 10, 10)};
+    rive::AABBTree tree;
+    tree.build(boxes);
+
+    std::vector<uint32_t> results;
+    tree.query(rive::AABB(5, 5, 6, 6), results);
+    REQUIRE(results == std::vector<uint32_t>{1});
+    tree.query(rive::AABB(-100, -100, -50, -50), results);
+    REQUIRE(results.empty());
+}
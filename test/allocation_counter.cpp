@@ -0,0 +1,44 @@
+#include "allocation_counter.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Replaces the global allocation functions for the whole test binary, the
+// aligned variants aren't counted.
+static std::atomic<size_t> gAllocations(0);
+static std::atomic<size_t> gAllocatedBytes(0);
+
+size_t AllocationCounter::total() { return gAllocations.load(std::memory_order_relaxed); }
+size_t AllocationCounter::totalBytes() { return gAllocatedBytes.load(std::memory_order_relaxed); }
+
+static void* countedAllocation(size_t size)
+{
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+    gAllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    return malloc(size == 0 ? 1 : size);
+}
+
+// Built without exceptions, so failing to allocate can't throw bad_alloc.
+static void* checkedAllocation(size_t size)
+{
+    void* memory = countedAllocation(size);
+    if (memory == nullptr)
+    {
+        abort();
+    }
+    return memory;
+}
+
+void* operator new(size_t size) { return checkedAllocation(size); }
+void* operator new[](size_t size) { return checkedAllocation(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return countedAllocation(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    return countedAllocation(size);
+}
+void operator delete(void* memory) noexcept { free(memory); }
+void operator delete[](void* memory) noexcept { free(memory); }
+void operator delete(void* memory, size_t) noexcept { free(memory); }
+void operator delete[](void* memory, size_t) noexcept { free(memory); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept { free(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { free(memory); }
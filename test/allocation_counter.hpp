@@ -0,0 +1,26 @@
+#ifndef _RIVE_ALLOCATION_COUNTER_HPP_
+#define _RIVE_ALLOCATION_COUNTER_HPP_
+
+#include <stddef.h>
+
+// Counts the heap allocations made through operator new (on any thread) from
+// when it's constructed.
+class AllocationCounter
+{
+public:
+    AllocationCounter() : m_start(total()), m_startBytes(totalBytes()) {}
+
+    size_t allocations() const { return total() - m_start; }
+    size_t bytes() const { return totalBytes() - m_startBytes; }
+
+    // Allocations made by the process so far.
+    static size_t total();
+    // Bytes requested by those allocations.
+    static size_t totalBytes();
+
+private:
+    size_t m_start;
+    size_t m_startBytes;
+};
+
+#endif
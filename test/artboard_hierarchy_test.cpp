@@ -0,0 +1,107 @@
+#include <rive/artboard.hpp>
+#include <rive/node.hpp>
+#include <utils/no_op_factory.hpp>
+#include <catch.hpp>
+#include <chrono>
+#include <cstdio>
+
+namespace
+{
+// Builds count nodes where node n (the artboard is object 0) is parented to
+// object parentOf(n).
+template <typename ParentOf>
+void buildNodes(rive::Artboard& artboard, size_t count, ParentOf parentOf)
+{
+    artboard.addObject(&artboard);
+    for (uint32_t i = 1; i <= count; i++)
+    {
+        auto node = new rive::Node();
+        node->parentId(parentOf(i));
+        node->x(1.0f);
+        artboard.addObject(node);
+    }
+}
+
+double elapsedMs(std::chrono::high_resolution_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() -
+                                                     start)
+        .count();
+}
+} // namespace
+
+TEST_CASE("artboard indexes children by parent", "[hierarchy]")
+{
+    rive::NoOpFactory factory;
+    rive::Artboard artboard(&factory);
+    // 1 and 2 on the artboard, 3 and 5 under 1, 4 under 3.
+    uint32_t parents[] = {0, 0, 0, 1, 3, 1};
+    buildNodes(artboard, 5, [&](uint32_t i) { return parents[i]; });
+    REQUIRE(artboard.initialize() == rive::StatusCode::Ok);
+
+    auto children = artboard.childIds(1);
+    REQUIRE(std::vector<uint32_t>(children.begin(), children.end()) ==
+            std::vector<uint32_t>{3, 5});
+    REQUIRE(artboard.childIds(4).empty());
+    REQUIRE(artboard.childIds(100).empty());
+
+    std::vector<uint32_t> ids;
+    artboard.subtreeIds(1, ids);
+    REQUIRE(ids == std::vector<uint32_t>{1, 3, 4, 5});
+    ids.clear();
+    artboard.subtreeIds(0, ids);
+    REQUIRE(ids.size() == 6);
+}
+
+TEST_CASE("deep hierarchies sort without recursing", "[hierarchy]")
+{
+    rive::NoOpFactory factory;
+    rive::Artboard artboard(&factory);
+    const size_t count = 100000;
+    buildNodes(artboard, count, [](uint32_t i) { return i - 1; });
+    REQUIRE(artboard.initialize() == rive::StatusCode::Ok);
+    REQUIRE(artboard.updateComponents());
+
+    auto& objects = artboard.objects();
+    for (size_t i = 1; i < count; i++)
+    {
+        REQUIRE(objects[i]->as<rive::Component>()->graphOrder() <
+                objects[i + 1]->as<rive::Component>()->graphOrder());
+    }
+    REQUIRE(objects[count]->as<rive::Node>()->worldTransform()[4] == (float)count);
+}
+
+TEST_CASE("artboard load and instance time scale with object count", "[.][benchmark]")
+{
+    rive::NoOpFactory factory;
+    for (size_t count : {25000, 50000, 100000})
+    {
+        for (bool deep : {false, true})
+        {
+            rive::Artboard artboard(&factory);
+            if (deep)
+            {
+                buildNodes(artboard, count, [](uint32_t i) { return i - 1; });
+            }
+            else
+            {
+                buildNodes(artboard, count, [](uint32_t i) { return i / 8; });
+            }
+
+            auto start = std::chrono::high_resolution_clock::now();
+            REQUIRE(artboard.initialize() == rive::StatusCode::Ok);
+            auto loadMs = elapsedMs(start);
+
+            start = std::chrono::high_resolution_clock::now();
+            auto instance = artboard.instance();
+            auto instanceMs = elapsedMs(start);
+            REQUIRE(instance != nullptr);
+
+            printf("%s artboard, %zu objects: initialize %.2fms, instance %.2fms\n",
+                   deep ? "deep" : "wide",
+                   count,
+                   loadMs,
+                   instanceMs);
+        }
+    }
+}
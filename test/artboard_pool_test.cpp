@@ -0,0 +1,158 @@
+#include <rive/animation/linear_animation_instance.hpp>
+#include <rive/artboard_pool.hpp>
+#include <rive/file.hpp>
+#include <rive/node.hpp>
+#include <rive/shapes/paint/solid_color.hpp>
+#include "rive_file_reader.hpp"
+#include <catch.hpp>
+#include <chrono>
+#include <cstdio>
+
+// Compares the properties animations can change (through their effect on
+// world transforms and paint colors) of two instances of the same artboard.
+static void requireSameState(rive::ArtboardInstance* a, rive::ArtboardInstance* b)
+{
+    a->advance(0.0f);
+    b->advance(0.0f);
+    REQUIRE(a->objects().size() == b->objects().size());
+    for (size_t id = 1; id < a->objects().size(); id++)
+    {
+        auto objectA = a->objects()[id];
+        auto objectB = b->objects()[id];
+        if (objectA == nullptr)
+        {
+            continue;
+        }
+        if (objectA->is<rive::Node>())
+        {
+            REQUIRE(objectA->as<rive::Node>()->worldTransform() ==
+                    objectB->as<rive::Node>()->worldTransform());
+            REQUIRE(objectA->as<rive::Node>()->opacity() ==
+                    objectB->as<rive::Node>()->opacity());
+        }
+        else if (objectA->is<rive::SolidColor>())
+        {
+            REQUIRE(objectA->as<rive::SolidColor>()->colorValue() ==
+                    objectB->as<rive::SolidColor>()->colorValue());
+        }
+    }
+}
+
+TEST_CASE("released instances are reset and recycled", "[pool]")
+{
+    for (auto path : {"../../test/assets/off_road_car.riv", "../../test/assets/juice.riv"})
+    {
+        auto file = ReadRiveFile(path);
+        rive::ArtboardPool pool(file->artboard());
+
+        auto instance = pool.acquire();
+        auto recycled = instance.get();
+        for (size_t i = 0; i < instance->animationCount(); i++)
+        {
+            auto animation = instance->animationAt(i);
+            animation->advanceAndApply(0.5f);
+        }
+        pool.release(std::move(instance));
+        REQUIRE(pool.idleCount() == 1);
+
+        instance = pool.acquire();
+        REQUIRE(instance.get() == recycled);
+        REQUIRE(pool.idleCount() == 0);
+
+        auto fresh = file->artboardDefault();
+        requireSameState(instance.get(), fresh.get());
+
+        // It animates like a new instance too.
+        auto animation = instance->animationAt(0);
+        auto freshAnimation = fresh->animationAt(0);
+        animation->advanceAndApply(0.25f);
+        freshAnimation->advanceAndApply(0.25f);
+        requireSameState(instance.get(), fresh.get());
+    }
+}
+
+TEST_CASE("recycled instances drop properties set directly", "[pool]")
+{
+    auto file = ReadRiveFile("../../test/assets/off_road_car.riv");
+    auto artboard = file->artboard();
+    rive::ArtboardPool pool(artboard);
+
+    auto instance = pool.acquire();
+    auto recycled = instance.get();
+    // No animation keys the artboard's size, set a node's position too.
+    rive::Node* node = nullptr;
+    for (auto object : instance->objects())
+    {
+        if (object != nullptr && object != recycled && object->is<rive::Node>())
+        {
+            node = object->as<rive::Node>();
+            break;
+        }
+    }
+    REQUIRE(node != nullptr);
+    auto sourceNode = artboard->resolve(instance->idOf(node))->as<rive::Node>();
+    instance->width(artboard->width() + 100.0f);
+    instance->height(artboard->height() * 2.0f);
+    node->x(sourceNode->x() + 50.0f);
+    node->y(sourceNode->y() - 50.0f);
+    instance->advance(0.0f);
+    pool.release(std::move(instance));
+
+    instance = pool.acquire();
+    REQUIRE(instance.get() == recycled);
+    REQUIRE(instance->width() == artboard->width());
+    REQUIRE(instance->height() == artboard->height());
+    REQUIRE(node->x() == sourceNode->x());
+    REQUIRE(node->y() == sourceNode->y());
+
+    auto fresh = file->artboardDefault();
+    requireSameState(instance.get(), fresh.get());
+    REQUIRE(instance->bounds() == fresh->bounds());
+}
+
+TEST_CASE("pools only take back their own instances", "[pool]")
+{
+    auto file = ReadRiveFile("../../test/assets/two_artboards.riv");
+    rive::ArtboardPool pool(file->artboard(0), 1);
+    REQUIRE(!file->artboard(0)->resetInstance(file->artboardAt(1).get()));
+
+    pool.release(file->artboardAt(1));
+    REQUIRE(pool.idleCount() == 0);
+
+    pool.release(pool.acquire());
+    pool.release(pool.acquire());
+    REQUIRE(pool.idleCount() == 1);
+    pool.release(file->artboardAt(0));
+    REQUIRE(pool.idleCount() == 1);
+}
+
+TEST_CASE("recycling instances", "[.][benchmark]")
+{
+    auto file = ReadRiveFile("../../test/assets/off_road_car.riv");
+    auto source = file->artboard();
+    const int count = 1000;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < count; i++)
+    {
+        auto instance = source->instance();
+        instance->advance(0.0f);
+    }
+    auto instanced = std::chrono::high_resolution_clock::now();
+
+    rive::ArtboardPool pool(source);
+    pool.release(pool.acquire());
+    auto recycleStart = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < count; i++)
+    {
+        auto instance = pool.acquire();
+        instance->advance(0.0f);
+        pool.release(std::move(instance));
+    }
+    auto recycled = std::chrono::high_resolution_clock::now();
+
+    using us = std::chrono::duration<double, std::micro>;
+    printf("instance: %.1fus, pool acquire/release: %.1fus\n",
+           us(instanced - start).count() / count,
+           us(recycled - recycleStart).count() / count);
+}
@@ -0,0 +1,125 @@
+#include <rive/animation/linear_animation_instance.hpp>
+#include <rive/baked_file.hpp>
+#include <rive/byte_source.hpp>
+#include <rive/file.hpp>
+#include "recording_renderer.hpp"
+#include "rive_file_reader.hpp"
+#include <catch.hpp>
+#include <chrono>
+#include <cstdio>
+
+static std::vector<float> drawArtboard(const rive::File& file, size_t index)
+{
+    auto artboard = file.artboardAt(index);
+    if (artboard->animationCount() > 0)
+    {
+        auto animation = artboard->animationAt(0);
+        animation->advanceAndApply(animation->durationSeconds() * 0.5f);
+    }
+    artboard->advance(0.0f);
+    return recordDraw(artboard.get());
+}
+
+TEST_CASE("baked files import like the files they were baked from", "[file]")
+{
+    for (auto path : {"../../test/assets/two_artboards.riv",
+                      "../../test/assets/juice.riv",
+                      "../../test/assets/bullet_man.riv",
+                      "../../test/assets/draw_rule_cycle.riv",
+                      "../../test/assets/off_road_car.riv"})
+    {
+        auto source = rive::ByteSource::mapFile(path);
+        REQUIRE(source != nullptr);
+        rive::ImportResult result;
+        auto baked = rive::BakedFile::bake(source->bytes(), &gNoOpFactory, &result);
+        REQUIRE(result == rive::ImportResult::success);
+        REQUIRE(rive::BakedFile::isBaked(baked));
+        REQUIRE(!rive::BakedFile::isBaked(source->bytes()));
+
+        auto expected = rive::File::import(source, &gNoOpFactory);
+        REQUIRE(expected != nullptr);
+        for (auto loading : {rive::ArtboardLoading::eager, rive::ArtboardLoading::lazy})
+        {
+            auto file = rive::File::import(rive::ByteSource::makeUnowned(baked),
+                                           &gNoOpFactory,
+                                           &result,
+                                           nullptr,
+                                           loading);
+            REQUIRE(result == rive::ImportResult::success);
+            REQUIRE(file != nullptr);
+            REQUIRE(file->artboardCount() == expected->artboardCount());
+            for (size_t i = 0; i < expected->artboardCount(); i++)
+            {
+                auto artboard = file->artboard(i);
+                auto expectedArtboard = expected->artboard(i);
+                REQUIRE(artboard->objects().size() == expectedArtboard->objects().size());
+                for (size_t id = 0; id < artboard->objects().size(); id++)
+                {
+                    auto object = artboard->objects()[id];
+                    if (object != nullptr && object->is<rive::Component>())
+                    {
+                        REQUIRE(object->as<rive::Component>()->graphOrder() ==
+                                expectedArtboard->objects()[id]
+                                    ->as<rive::Component>()
+                                    ->graphOrder());
+                    }
+                }
+                REQUIRE(drawArtboard(*file, i) == drawArtboard(*expected, i));
+            }
+        }
+    }
+}
+
+TEST_CASE("damaged or mismatched baked files don't import", "[file]")
+{
+    auto source = rive::ByteSource::mapFile("../../test/assets/juice.riv");
+    REQUIRE(source != nullptr);
+    auto baked = rive::BakedFile::bake(source->bytes(), &gNoOpFactory);
+    REQUIRE(!baked.empty());
+
+    rive::ImportResult result;
+    auto damaged = baked;
+    damaged[40] ^= 0xFF;
+    REQUIRE(rive::File::import(damaged, &gNoOpFactory, &result) == nullptr);
+    REQUIRE(result == rive::ImportResult::malformed);
+
+    auto truncated = baked;
+    truncated.pop_back();
+    REQUIRE(rive::File::import(truncated, &gNoOpFactory, &result) == nullptr);
+    REQUIRE(result == rive::ImportResult::malformed);
+
+    auto otherVersion = baked;
+    otherVersion[4]++;
+    REQUIRE(rive::File::import(otherVersion, &gNoOpFactory, &result) == nullptr);
+    REQUIRE(result == rive::ImportResult::unsupportedVersion);
+
+    REQUIRE(rive::BakedFile::bake(source->bytes().subset(0, 3), &gNoOpFactory, &result).empty());
+    REQUIRE(result == rive::ImportResult::malformed);
+}
+
+TEST_CASE("import baked", "[.][benchmark]")
+{
+    for (auto path : {"../../test/assets/bullet_man.riv",
+                      "../../test/assets/juice.riv",
+                      "../../test/assets/off_road_car.riv"})
+    {
+        auto source = rive::ByteSource::mapFile(path);
+        REQUIRE(source != nullptr);
+        auto baked = rive::ByteSource::make(rive::BakedFile::bake(source->bytes(), &gNoOpFactory));
+        for (auto bytes : {source, baked})
+        {
+            const int iterations = 50;
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < iterations; i++)
+            {
+                REQUIRE(rive::File::import(bytes, &gNoOpFactory) != nullptr);
+            }
+            std::chrono::duration<double, std::milli> elapsed =
+                std::chrono::high_resolution_clock::now() - start;
+            printf("import %s (%s): %.3fms\n",
+                   path,
+                   bytes == baked ? "baked" : "riv",
+                   elapsed.count() / iterations);
+        }
+    }
+}
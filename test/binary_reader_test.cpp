@@ -1,5 +1,8 @@
 #include <catch.hpp>
 #include <rive/core/binary_reader.hpp>
+#include <rive/shapes/mesh.hpp>
+#include <chrono>
+#include <cstdio>
 
 template <typename T> void checkFits()
 {
@@ -66,3 +69,170 @@ TEST_CASE("range checks", "[binary_reader]")
     REQUIRE(!checkAs<uint16_t>(100000));
     REQUIRE(checkAs<uint32_t>(100000));
 }
+
+TEST_CASE("reading strings and bytes", "[binary_reader]")
+{
+    uint8_t storage[] = {4, 'F', 'i', 'l', 'l', 4, 'F', 'i', 'l', 'l', 3, 1, 2, 3, 9, 0};
+    rive::BinaryReader reader(rive::Span<const uint8_t>(storage, sizeof(storage)));
+
+    auto a = reader.readSharedString();
+    auto b = reader.readSharedString();
+    REQUIRE(a == "Fill");
+    // Equal strings share their characters.
+    REQUIRE(&a.str() == &b.str());
+
+    auto bytes = reader.readBytes();
+    REQUIRE(bytes.size() == 3);
+    REQUIRE(bytes.data() == storage + 11);
+    REQUIRE(!reader.hasError());
+
+    // Lengths past the end overflow.
+    bytes = reader.readBytes();
+    REQUIRE(bytes.size() == 0);
+    REQUIRE(reader.didOverflow());
+}
+
+TEST_CASE("reading varuints", "[binary_reader]")
+{
+    std::vector<uint64_t> values = {0, 1, 127, 128, 300, 16383, 16384, 1u << 21, 1u << 28};
+    values.push_back(std::numeric_limits<uint32_t>::max());
+    values.push_back(std::numeric_limits<uint64_t>::max());
+    std::vector<uint8_t> bytes(values.size() * 10);
+    uint8_t* end = bytes.data();
+    for (auto value : values)
+    {
+        end = packvarint(end, value);
+    }
+
+    // With and without room for the unchecked path.
+    for (size_t padding : {0, 16})
+    {
+        std::vector<uint8_t> padded(bytes.data(), end);
+        padded.resize(padded.size() + padding, 0);
+        rive::BinaryReader reader(padded);
+        for (auto value : values)
+        {
+            REQUIRE(reader.peekVarUint64() == value);
+            REQUIRE(reader.readVarUint64() == value);
+        }
+        REQUIRE(!reader.hasError());
+    }
+
+    // Values cut off at the end overflow.
+    for (size_t size = 1; size < 10; size++)
+    {
+        std::vector<uint8_t> truncated(size, 0x80);
+        rive::BinaryReader reader(truncated);
+        REQUIRE(reader.readVarUint64() == 0);
+        REQUIRE(reader.didOverflow());
+    }
+
+    // As do values longer than a uint64 can be.
+    std::vector<uint8_t> tooLong(16, 0x80);
+    tooLong.back() = 1;
+    rive::BinaryReader reader(tooLong);
+    REQUIRE(reader.readVarUint64() == 0);
+    REQUIRE(reader.didOverflow());
+}
+
+TEST_CASE("reading runs of varuints", "[binary_reader]")
+{
+    // Runs of single byte values, multi byte values, and both mixed, with
+    // sizes that don't line up with the bulk path.
+    for (size_t count : {0, 1, 7, 8, 9, 15, 16, 17, 33, 100, 1001})
+    {
+        for (uint32_t scale : {1, 37, 301})
+        {
+            std::vector<uint16_t> values;
+            std::vector<uint8_t> bytes(count * 3);
+            uint8_t* end = bytes.data();
+            for (size_t i = 0; i < count; i++)
+            {
+                values.push_back((uint16_t)((i * scale) % 65536));
+                end = packvarint(end, values.back());
+            }
+            bytes.resize(end - bytes.data());
+
+            rive::BinaryReader reader(bytes);
+            std::vector<uint16_t> decoded = {42};
+            reader.readVarUint16s(decoded);
+            REQUIRE(!reader.hasError());
+            REQUIRE(decoded[0] == 42);
+            decoded.erase(decoded.begin());
+            REQUIRE(decoded == values);
+        }
+    }
+
+    uint8_t outOfRange[] = {1, 2, 0x80, 0x80, 0x04};
+    rive::BinaryReader reader(rive::Span<const uint8_t>(outOfRange, sizeof(outOfRange)));
+    std::vector<uint16_t> decoded;
+    reader.readVarUint16s(decoded);
+    REQUIRE(reader.didIntRangeError());
+
+    uint8_t truncated[] = {1, 2, 0x80};
+    rive::BinaryReader truncatedReader(rive::Span<const uint8_t>(truncated, sizeof(truncated)));
+    truncatedReader.readVarUint16s(decoded);
+    REQUIRE(truncatedReader.didOverflow());
+}
+
+TEST_CASE("varuint decoding", "[.][benchmark]")
+{
+    // Triangle indices of a 64x64 vertex grid, like an image mesh's.
+    const uint32_t size = 64;
+    std::vector<uint8_t> indexBytes(size * size * 6 * 3);
+    uint8_t* end = indexBytes.data();
+    for (uint32_t y = 0; y + 1 < size; y++)
+    {
+        for (uint32_t x = 0; x + 1 < size; x++)
+        {
+            uint32_t i = y * size + x;
+            for (auto index : {i, i + 1, i + size, i + 1, i + size + 1, i + size})
+            {
+                end = packvarint(end, index);
+            }
+        }
+    }
+    indexBytes.resize(end - indexBytes.data());
+
+    // Mostly single byte values, like property keys and ids.
+    std::vector<uint8_t> mixedBytes(1 << 20);
+    end = mixedBytes.data();
+    uint32_t seed = 1;
+    size_t mixedCount = 0;
+    while (mixedBytes.data() + mixedBytes.size() - end > 10)
+    {
+        seed = seed * 1664525 + 1013904223;
+        end = packvarint(end, (seed >> 8) % 8 == 0 ? (seed >> 8) % 20000 : (seed >> 8) % 128);
+        mixedCount++;
+    }
+    mixedBytes.resize(end - mixedBytes.data());
+
+    const int iterations = 200;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; i++)
+    {
+        rive::Mesh mesh;
+        mesh.decodeTriangleIndexBytes(indexBytes);
+    }
+    std::chrono::duration<double, std::micro> elapsed =
+        std::chrono::high_resolution_clock::now() - start;
+    printf("mesh indices: %zu bytes in %.1fus\n",
+           indexBytes.size(),
+           elapsed.count() / iterations);
+
+    start = std::chrono::high_resolution_clock::now();
+    uint64_t sum = 0;
+    for (int i = 0; i < iterations / 10; i++)
+    {
+        rive::BinaryReader reader(mixedBytes);
+        while (!reader.reachedEnd())
+        {
+            sum += reader.readVarUint64();
+        }
+    }
+    elapsed = std::chrono::high_resolution_clock::now() - start;
+    printf("mixed varuints: %zu in %.1fus (%llu)\n",
+           mixedCount,
+           elapsed.count() / (iterations / 10),
+           (unsigned long long)sum);
+}
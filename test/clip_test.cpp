@@ -31,18 +31,22 @@ class ClipTestRenderPath : public rive::RenderPath
 {
 public:
     rive::RawPath rawPath;
+    ClipTestRenderPath() {}
     ClipTestRenderPath(rive::RawPath& path) : rawPath(path) {}
 
-    void reset() override {}
+    void reset() override { rawPath.rewind(); }
 
     void fillRule(rive::FillRule value) override {}
     void addPath(rive::CommandPath* path, const rive::Mat2D& transform) override {}
     void addRenderPath(rive::RenderPath* path, const rive::Mat2D& transform) override {}
 
-    void moveTo(float x, float y) override {}
-    void lineTo(float x, float y) override {}
-    void cubicTo(float ox, float oy, float ix, float iy, float x, float y) override {}
-    void close() override {}
+    void moveTo(float x, float y) override { rawPath.moveTo(x, y); }
+    void lineTo(float x, float y) override { rawPath.lineTo(x, y); }
+    void cubicTo(float ox, float oy, float ix, float iy, float x, float y) override
+    {
+        rawPath.cubicTo(ox, oy, ix, iy, x, y);
+    }
+    void close() override { rawPath.close(); }
 };
 
 class ClippingFactory : public rive::NoOpFactory
@@ -52,6 +56,11 @@ class ClippingFactory : public rive::NoOpFactory
     {
         return std::make_unique<ClipTestRenderPath>(rawPath);
     }
+
+    std::unique_ptr<rive::RenderPath> makeEmptyRenderPath() override
+    {
+        return std::make_unique<ClipTestRenderPath>();
+    }
 };
 
 TEST_CASE("artboard is clipped correctly", "[clipping]")
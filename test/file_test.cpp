@@ -3,9 +3,13 @@
 #include <rive/shapes/rectangle.hpp>
 #include <rive/shapes/shape.hpp>
 #include <rive/assets/image_asset.hpp>
+#include <rive/rive_counter.hpp>
+#include <rive/worker_pool.hpp>
 #include "utils/no_op_renderer.hpp"
+#include "allocation_counter.hpp"
 #include "rive_file_reader.hpp"
 #include <catch.hpp>
+#include <chrono>
 #include <cstdio>
 #include <cstring>
 
@@ -194,3 +198,215 @@ TEST_CASE("file with in-band images can have the stripped", "[file]")
 
 // Draw will be called by C++ on the Shape, the Shape will call draw on the
 // fill/stroke (propagates to jsFill/jsStroke)
+
+TEST_CASE("file can retain the bytes it's imported from", "[file]")
+{
+    auto source = rive::ByteSource::mapFile("../../test/assets/two_artboards.riv");
+    REQUIRE(source != nullptr);
+    REQUIRE(source->bytes().size() > 0);
+
+    rive::ImportResult result;
+    auto file = rive::File::import(source, &gNoOpFactory, &result);
+    REQUIRE(result == rive::ImportResult::success);
+    REQUIRE(file != nullptr);
+    REQUIRE(file->source() == source.get());
+    REQUIRE(file->artboardCount() == 2);
+
+    // Copies of the bytes work the same way.
+    std::vector<uint8_t> bytes(source->bytes().begin(), source->bytes().end());
+    file = rive::File::import(rive::ByteSource::make(std::move(bytes)), &gNoOpFactory, &result);
+    REQUIRE(result == rive::ImportResult::success);
+    REQUIRE(file->source() != source.get());
+    REQUIRE(file->artboardCount() == 2);
+
+    REQUIRE(rive::ByteSource::mapFile("../../test/assets/missing.riv") == nullptr);
+}
+
+TEST_CASE("lazily loaded artboards match eagerly loaded ones", "[file]")
+{
+    for (auto path : {"../../test/assets/two_artboards.riv",
+                      "../../test/assets/juice.riv",
+                      "../../test/assets/walle.riv",
+                      "../../test/assets/jellyfish_test.riv",
+                      "../../test/assets/multiple_state_machines.riv"})
+    {
+        auto source = rive::ByteSource::mapFile(path);
+        REQUIRE(source != nullptr);
+        auto eager = rive::File::import(source, &gNoOpFactory);
+        rive::ImportResult result;
+        auto lazy = rive::File::import(source,
+                                       &gNoOpFactory,
+                                       &result,
+                                       nullptr,
+                                       rive::ArtboardLoading::lazy);
+        REQUIRE(result == rive::ImportResult::success);
+        REQUIRE(lazy->artboardCount() == eager->artboardCount());
+        for (size_t i = 0; i < eager->artboardCount(); i++)
+        {
+            REQUIRE(lazy->artboardNameAt(i) == eager->artboardNameAt(i));
+            auto lazyArtboard = lazy->artboard(i);
+            auto eagerArtboard = eager->artboard(i);
+            REQUIRE(lazyArtboard != nullptr);
+            REQUIRE(lazyArtboard->objects().size() == eagerArtboard->objects().size());
+            REQUIRE(lazyArtboard->animationCount() == eagerArtboard->animationCount());
+            REQUIRE(lazyArtboard->stateMachineCount() == eagerArtboard->stateMachineCount());
+            for (size_t j = 0; j < eagerArtboard->objects().size(); j++)
+            {
+                auto lazyObject = lazyArtboard->objects()[j];
+                auto eagerObject = eagerArtboard->objects()[j];
+                REQUIRE((lazyObject == nullptr) == (eagerObject == nullptr));
+                if (eagerObject != nullptr)
+                {
+                    REQUIRE(lazyObject->coreType() == eagerObject->coreType());
+                }
+            }
+            // Loading again returns the same artboard.
+            REQUIRE(lazy->artboard(i) == lazyArtboard);
+            REQUIRE(lazy->artboardAt(i) != nullptr);
+        }
+    }
+}
+
+TEST_CASE("lazily loaded artboards are only imported when asked for", "[file]")
+{
+    auto source = rive::ByteSource::mapFile("../../test/assets/two_artboards.riv");
+    REQUIRE(source != nullptr);
+    int paths = rive::Counter::counts[rive::Counter::kPath];
+    auto file = rive::File::import(source,
+                                   &gNoOpFactory,
+                                   nullptr,
+                                   nullptr,
+                                   rive::ArtboardLoading::lazy);
+    REQUIRE(file != nullptr);
+    REQUIRE(file->artboardNameAt(1) == "One");
+    REQUIRE(rive::Counter::counts[rive::Counter::kPath] == paths);
+
+    REQUIRE(file->artboard("One") != nullptr);
+    int onePaths = rive::Counter::counts[rive::Counter::kPath];
+    REQUIRE(onePaths > paths);
+    REQUIRE(file->artboard("One") != nullptr);
+    REQUIRE(rive::Counter::counts[rive::Counter::kPath] == onePaths);
+
+    REQUIRE(file->artboard()->name() == "Two");
+    REQUIRE(rive::Counter::counts[rive::Counter::kPath] > onePaths);
+}
+
+TEST_CASE("artboards imported across workers match serially imported ones", "[file]")
+{
+    rive::WorkerPool workers(4);
+    for (auto path : {"../../test/assets/two_artboards.riv",
+                      "../../test/assets/juice.riv",
+                      "../../test/assets/walle.riv",
+                      "../../test/assets/jellyfish_test.riv",
+                      "../../test/assets/multiple_state_machines.riv"})
+    {
+        auto source = rive::ByteSource::mapFile(path);
+        REQUIRE(source != nullptr);
+        auto serial = rive::File::import(source, &gNoOpFactory);
+        rive::ImportResult result;
+        auto parallel = rive::File::import(source,
+                                           &gNoOpFactory,
+                                           &result,
+                                           nullptr,
+                                           rive::ArtboardLoading::eager,
+                                           &workers);
+        REQUIRE(result == rive::ImportResult::success);
+        REQUIRE(parallel->artboardCount() == serial->artboardCount());
+        for (size_t i = 0; i < serial->artboardCount(); i++)
+        {
+            auto parallelArtboard = parallel->artboard(i);
+            auto serialArtboard = serial->artboard(i);
+            REQUIRE(parallelArtboard->name() == serialArtboard->name());
+            REQUIRE(parallelArtboard->objects().size() == serialArtboard->objects().size());
+            REQUIRE(parallelArtboard->animationCount() == serialArtboard->animationCount());
+            REQUIRE(parallelArtboard->stateMachineCount() == serialArtboard->stateMachineCount());
+
+            auto parallelInstance = parallelArtboard->instance();
+            auto serialInstance = serialArtboard->instance();
+            parallelInstance->advance(0.0f);
+            serialInstance->advance(0.0f);
+            for (size_t j = 0; j < serialInstance->objects().size(); j++)
+            {
+                auto parallelObject = parallelInstance->objects()[j];
+                auto serialObject = serialInstance->objects()[j];
+                REQUIRE((parallelObject == nullptr) == (serialObject == nullptr));
+                if (serialObject != nullptr && serialObject->is<rive::Node>())
+                {
+                    REQUIRE(parallelObject->as<rive::Node>()->worldTransform() ==
+                            serialObject->as<rive::Node>()->worldTransform());
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("import across workers", "[.][benchmark]")
+{
+    for (auto path : {"../../test/assets/bullet_man.riv",
+                      "../../test/assets/tape.riv",
+                      "../../test/assets/two_artboards.riv"})
+    {
+        auto source = rive::ByteSource::mapFile(path);
+        REQUIRE(source != nullptr);
+        for (size_t threadCount : {1, 2, 4, 8})
+        {
+            rive::WorkerPool workers(threadCount);
+            const int iterations = 20;
+            size_t artboardCount = 0;
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < iterations; i++)
+            {
+                auto file = rive::File::import(source,
+                                               &gNoOpFactory,
+                                               nullptr,
+                                               nullptr,
+                                               rive::ArtboardLoading::eager,
+                                               &workers);
+                REQUIRE(file != nullptr);
+                artboardCount = file->artboardCount();
+            }
+            auto elapsed = std::chrono::high_resolution_clock::now() - start;
+            printf("import %s (%zu artboards) across %zu threads: %.3fms\n",
+                   path,
+                   artboardCount,
+                   threadCount,
+                   std::chrono::duration<double, std::milli>(elapsed).count() / iterations);
+        }
+    }
+}
+
+TEST_CASE("import allocations and time", "[.][benchmark]")
+{
+    for (auto path : {"../../test/assets/bullet_man.riv",
+                      "../../test/assets/juice.riv",
+                      "../../test/assets/off_road_car.riv",
+                      "../../test/assets/tape.riv"})
+    {
+        auto source = rive::ByteSource::mapFile(path);
+        REQUIRE(source != nullptr);
+        for (auto loading : {rive::ArtboardLoading::eager, rive::ArtboardLoading::lazy})
+        {
+            size_t allocations = 0;
+            const int iterations = 50;
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < iterations; i++)
+            {
+                AllocationCounter counter;
+                auto file = rive::File::import(source, &gNoOpFactory, nullptr, nullptr, loading);
+                REQUIRE(file != nullptr);
+                // Load every artboard so both modes do the same work.
+                for (size_t j = 0; j < file->artboardCount(); j++)
+                {
+                    file->artboard(j);
+                }
+                allocations = counter.allocations();
+            }
+            auto elapsed = std::chrono::high_resolution_clock::now() - start;
+            printf("import %s (%s): %zu allocations, %.3fms\n",
+                   path,
+                   loading == rive::ArtboardLoading::eager ? "eager" : "lazy",
+                   allocations,
+                   std::chrono::duration<double, std::milli>(elapsed).count() / iterations);
+        }
+    }
+}
@@ -0,0 +1,85 @@
+#include <rive/animation/linear_animation_instance.hpp>
+#include <rive/animation/state_machine_instance.hpp>
+#include <rive/file.hpp>
+#include <utils/no_op_renderer.hpp>
+#include "allocation_counter.hpp"
+#include "rive_file_reader.hpp"
+#include <catch.hpp>
+#include <cmath>
+
+// Counts the allocations made advancing and drawing scene for a couple of
+// seconds, once it's been running long enough that its scratch storage has
+// grown to what it needs.
+static size_t frameAllocations(rive::ArtboardInstance* artboard, rive::Scene* scene)
+{
+    // Long enough for looping animations to come around (ping pong ones
+    // twice) and for state machines to settle into their states.
+    const float frameSeconds = 1.0f / 60.0f;
+    auto duration = scene->durationSeconds();
+    int warmUpFrames = 120 + (duration > 0.0f ? (int)std::ceil(duration * 2.0f * 60.0f) : 0);
+    rive::NoOpRenderer renderer;
+    for (int frame = 0; frame < warmUpFrames; frame++)
+    {
+        scene->advanceAndApply(frameSeconds);
+        artboard->draw(&renderer);
+    }
+
+    AllocationCounter counter;
+    for (int frame = 0; frame < 120; frame++)
+    {
+        scene->advanceAndApply(frameSeconds);
+        artboard->draw(&renderer);
+    }
+    return counter.allocations();
+}
+
+TEST_CASE("steady state frames don't allocate", "[allocations]")
+{
+    for (auto path : {"../../test/assets/artboardclipping.riv",
+                      "../../test/assets/blend_test.riv",
+                      "../../test/assets/bullet_man.riv",
+                      "../../test/assets/circle_clips.riv",
+                      "../../test/assets/complex_ik_dependency.riv",
+                      "../../test/assets/dependency_test.riv",
+                      "../../test/assets/distance_constraint.riv",
+                      "../../test/assets/draw_rule_cycle.riv",
+                      "../../test/assets/entry.riv",
+                      "../../test/assets/fix_rectangle.riv",
+                      "../../test/assets/jellyfish_test.riv",
+                      "../../test/assets/juice.riv",
+                      "../../test/assets/light_switch.riv",
+                      "../../test/assets/long_name.riv",
+                      "../../test/assets/multiple_state_machines.riv",
+                      "../../test/assets/off_road_car.riv",
+                      "../../test/assets/rocket.riv",
+                      "../../test/assets/rotation_constraint.riv",
+                      "../../test/assets/scale_constraint.riv",
+                      "../../test/assets/shapetest.riv",
+                      "../../test/assets/stroke_name_test.riv",
+                      "../../test/assets/tape.riv",
+                      "../../test/assets/transform_constraint.riv",
+                      "../../test/assets/translation_constraint.riv",
+                      "../../test/assets/trim_path_linear.riv",
+                      "../../test/assets/two_artboards.riv",
+                      "../../test/assets/two_bone_ik.riv",
+                      "../../test/assets/walle.riv"})
+    {
+        auto file = ReadRiveFile(path);
+        for (size_t i = 0; i < file->artboardCount(); i++)
+        {
+            auto artboard = file->artboardAt(i);
+            for (size_t j = 0; j < artboard->animationCount(); j++)
+            {
+                auto animation = artboard->animationAt(j);
+                INFO(path << " artboard " << i << " animation " << j);
+                REQUIRE(frameAllocations(artboard.get(), animation.get()) == 0);
+            }
+            for (size_t j = 0; j < artboard->stateMachineCount(); j++)
+            {
+                auto stateMachine = artboard->stateMachineAt(j);
+                INFO(path << " artboard " << i << " state machine " << j);
+                REQUIRE(frameAllocations(artboard.get(), stateMachine.get()) == 0);
+            }
+        }
+    }
+}
@@ -1,3 +1,4 @@
+#include <rive/byte_source.hpp>
 #include <rive/file.hpp>
 #include <rive/node.hpp>
 #include <rive/shapes/clipping_shape.hpp>
@@ -5,11 +6,15 @@
 #include <rive/shapes/image.hpp>
 #include <rive/assets/image_asset.hpp>
 #include <rive/relative_local_asset_resolver.hpp>
+#include <rive/worker_pool.hpp>
 #include <utils/no_op_factory.hpp>
 #include <utils/no_op_renderer.hpp>
 #include "rive_file_reader.hpp"
 #include <catch.hpp>
+#include <atomic>
+#include <chrono>
 #include <cstdio>
+#include <thread>
 
 TEST_CASE("image assets loads correctly", "[assets]")
 {
@@ -79,3 +84,113 @@ TEST_CASE("out of band image assets loads correctly", "[assets]")
     rive::NoOpRenderer renderer;
     file->artboard()->draw(&renderer);
 }
+
+namespace
+{
+// Decodes every image to a blank one, slowly, noting which thread did it.
+class SlowDecodingFactory : public rive::NoOpFactory
+{
+public:
+    std::atomic<int> decodes{0};
+    std::atomic<int> offThreadDecodes{0};
+    std::thread::id importThread = std::this_thread::get_id();
+
+    std::unique_ptr<rive::RenderImage> decodeImage(rive::Span<const uint8_t>) override
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        decodes++;
+        if (std::this_thread::get_id() != importThread)
+        {
+            offThreadDecodes++;
+        }
+        return std::make_unique<rive::RenderImage>();
+    }
+};
+
+// Loads contents on a thread of its own.
+class ThreadedAssetResolver : public rive::RelativeLocalAssetResolver
+{
+    std::vector<std::thread> m_Threads;
+
+public:
+    using RelativeLocalAssetResolver::RelativeLocalAssetResolver;
+    ~ThreadedAssetResolver() override
+    {
+        for (auto& thread : m_Threads)
+        {
+            thread.join();
+        }
+    }
+
+    void loadContentsAsync(rive::FileAsset& asset, Completion* completion) override
+    {
+        m_Threads.emplace_back([this, &asset, completion]() {
+            loadContents(asset);
+            completion->complete();
+        });
+    }
+};
+} // namespace
+
+TEST_CASE("image assets can be decoded in the background", "[assets]")
+{
+    SlowDecodingFactory factory;
+    rive::WorkerPool workers(4);
+    auto source = rive::ByteSource::mapFile("../../test/assets/walle.riv");
+    REQUIRE(source != nullptr);
+    auto file = rive::File::import(source,
+                                   &factory,
+                                   nullptr,
+                                   nullptr,
+                                   rive::ArtboardLoading::eager,
+                                   &workers);
+    REQUIRE(file != nullptr);
+
+    // Images that haven't been decoded yet draw nothing.
+    auto artboard = file->artboardDefault();
+    artboard->advance(0.0f);
+    rive::NoOpRenderer renderer;
+    artboard->draw(&renderer);
+
+    file->waitForAssets();
+    REQUIRE(factory.decodes == (int)file->assets().size());
+    REQUIRE(factory.offThreadDecodes > 0);
+    auto walle = artboard->find<rive::Image>("walle");
+    REQUIRE(walle != nullptr);
+    REQUIRE(walle->imageAsset()->renderImage() != nullptr);
+    REQUIRE(walle->imageAsset()->decodedByteSize == 218873);
+    artboard->draw(&renderer);
+
+    // Files can go away with decodes still running.
+    file = rive::File::import(source,
+                              &factory,
+                              nullptr,
+                              nullptr,
+                              rive::ArtboardLoading::eager,
+                              &workers);
+    file.reset();
+}
+
+TEST_CASE("out of band image assets can be loaded asynchronously", "[assets]")
+{
+    SlowDecodingFactory factory;
+    rive::WorkerPool workers(2);
+    std::string filename = "../../test/assets/out_of_band/walle.riv";
+    ThreadedAssetResolver resolver(filename, &factory);
+    auto source = rive::ByteSource::mapFile(filename.c_str());
+    REQUIRE(source != nullptr);
+    auto file = rive::File::import(source,
+                                   &factory,
+                                   nullptr,
+                                   &resolver,
+                                   rive::ArtboardLoading::eager,
+                                   &workers);
+    REQUIRE(file != nullptr);
+    file->waitForAssets();
+    REQUIRE(factory.offThreadDecodes == (int)file->assets().size());
+
+    auto walle = file->artboard()->find<rive::Image>("walle");
+    REQUIRE(walle != nullptr);
+    REQUIRE(walle->imageAsset()->renderImage() != nullptr);
+    REQUIRE(walle->imageAsset()->decodedByteSize == 218873);
+}
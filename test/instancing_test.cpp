@@ -1,13 +1,43 @@
+#include <rive/animation/linear_animation_instance.hpp>
+#include <rive/animation/state_machine_instance.hpp>
+#include <rive/byte_source.hpp>
 #include <rive/file.hpp>
 #include <rive/node.hpp>
 #include <rive/shapes/clipping_shape.hpp>
 #include <rive/shapes/rectangle.hpp>
 #include <rive/shapes/shape.hpp>
 #include <utils/no_op_factory.hpp>
-#include <utils/no_op_renderer.hpp>
+#include "allocation_counter.hpp"
+#include "recording_renderer.hpp"
 #include "rive_file_reader.hpp"
 #include <catch.hpp>
+#include <chrono>
 #include <cstdio>
+#include <thread>
+
+namespace
+{
+// Plays the artboard's first state machine (or animation) for a bit, then
+// records what it draws.
+std::vector<float> playAndDraw(rive::ArtboardInstance* artboard)
+{
+    std::unique_ptr<rive::Scene> scene;
+    if (artboard->stateMachineCount() > 0)
+    {
+        scene = artboard->stateMachineAt(0);
+    }
+    else if (artboard->animationCount() > 0)
+    {
+        scene = artboard->animationAt(0);
+    }
+    for (int frame = 0; frame < 5 && scene != nullptr; frame++)
+    {
+        scene->advanceAndApply(0.1f);
+    }
+    artboard->advance(0.0f);
+    return recordDraw(artboard);
+}
+} // namespace
 
 TEST_CASE("cloning an ellipse works", "[instancing]")
 {
@@ -48,6 +78,25 @@ TEST_CASE("instancing artboard clones clipped properties", "[instancing]")
     artboard->draw(&renderer);
 }
 
+TEST_CASE("instances share names until they're set", "[instancing]")
+{
+    auto file = ReadRiveFile("../../test/assets/circle_clips.riv");
+    auto sourceNode = file->artboard()->find<rive::Shape>("TopEllipse");
+    auto artboard = file->artboardDefault();
+    auto node = artboard->find<rive::Shape>("TopEllipse");
+    REQUIRE(node != nullptr);
+    REQUIRE(&node->name() == &sourceNode->name());
+
+    node->name("Renamed");
+    REQUIRE(node->name() == "Renamed");
+    REQUIRE(sourceNode->name() == "TopEllipse");
+    REQUIRE(artboard->find<rive::Shape>("TopEllipse") == nullptr);
+
+    // Empty names don't need any storage.
+    node->name("");
+    REQUIRE(node->name().empty());
+}
+
 TEST_CASE("instancing artboard doesn't clone animations", "[instancing]")
 {
     auto file = ReadRiveFile("../../test/assets/juice.riv");
@@ -66,3 +115,257 @@ TEST_CASE("instancing artboard doesn't clone animations", "[instancing]")
     // Now the animations should've been deleted.
     REQUIRE(rive::LinearAnimation::deleteCount == numberOfAnimations);
 }
+
+static std::vector<unsigned int> dependentOrders(const rive::Component* component)
+{
+    std::vector<unsigned int> orders;
+    for (auto dependent : component->dependents())
+    {
+        orders.push_back(dependent->graphOrder());
+    }
+    return orders;
+}
+
+TEST_CASE("instances are wired like their source artboard", "[instancing]")
+{
+    for (auto path : {"../../test/assets/circle_clips.riv",
+                      "../../test/assets/draw_rule_cycle.riv",
+                      "../../test/assets/complex_ik_dependency.riv",
+                      "../../test/assets/off_road_car.riv",
+                      "../../test/assets/walle.riv"})
+    {
+        auto file = ReadRiveFile(path);
+        auto source = file->artboard();
+        source->updateComponents();
+        auto artboard = file->artboardDefault();
+        REQUIRE(artboard->objects().size() == source->objects().size());
+
+        for (size_t id = 0; id < source->objects().size(); id++)
+        {
+            auto sourceObject = source->objects()[id];
+            auto object = artboard->objects()[id];
+            if (sourceObject == nullptr || !sourceObject->is<rive::Component>())
+            {
+                continue;
+            }
+            auto sourceComponent = sourceObject->as<rive::Component>();
+            auto component = object->as<rive::Component>();
+            REQUIRE(component->graphOrder() == sourceComponent->graphOrder());
+            REQUIRE(dependentOrders(component) == dependentOrders(sourceComponent));
+
+            if (sourceObject->is<rive::Shape>())
+            {
+                auto sourceComposer = sourceObject->as<rive::Shape>()->pathComposer();
+                auto composer = object->as<rive::Shape>()->pathComposer();
+                REQUIRE(composer->graphOrder() == sourceComposer->graphOrder());
+                REQUIRE(dependentOrders(composer) == dependentOrders(sourceComposer));
+            }
+        }
+
+        artboard->updateComponents();
+        rive::NoOpRenderer renderer;
+        artboard->draw(&renderer);
+    }
+}
+
+TEST_CASE("arena instances match individually allocated ones", "[instancing]")
+{
+    auto file = ReadRiveFile("../../test/assets/off_road_car.riv");
+    auto source = file->artboard();
+    auto individual = source->instance(rive::Artboard::ObjectAllocation::individual);
+    auto arena = source->instance(rive::Artboard::ObjectAllocation::arena);
+    REQUIRE(arena->objects().size() == individual->objects().size());
+
+    // Objects are laid out in id order.
+    const rive::Core* previous = nullptr;
+    for (size_t id = 1; id < arena->objects().size(); id++)
+    {
+        auto object = arena->objects()[id];
+        if (object == nullptr)
+        {
+            continue;
+        }
+        REQUIRE(object->coreType() == individual->objects()[id]->coreType());
+        REQUIRE(object > previous);
+        previous = object;
+    }
+
+    auto individualAnimation = individual->animationAt(0);
+    auto arenaAnimation = arena->animationAt(0);
+    for (int frame = 0; frame < 60; frame++)
+    {
+        individualAnimation->advanceAndApply(1.0f / 60.0f);
+        arenaAnimation->advanceAndApply(1.0f / 60.0f);
+    }
+    for (size_t id = 1; id < arena->objects().size(); id++)
+    {
+        auto object = arena->objects()[id];
+        if (object != nullptr && object->is<rive::Node>())
+        {
+            REQUIRE(object->as<rive::Node>()->worldTransform() ==
+                    individual->objects()[id]->as<rive::Node>()->worldTransform());
+        }
+    }
+
+    rive::NoOpRenderer renderer;
+    arena->draw(&renderer);
+}
+
+TEST_CASE("instance allocation modes", "[.][benchmark]")
+{
+    using ObjectAllocation = rive::Artboard::ObjectAllocation;
+    const int instanceCount = 100;
+    const int frames = 120;
+    for (auto path : {"../../test/assets/off_road_car.riv",
+                      "../../test/assets/walle.riv",
+                      "../../test/assets/juice.riv",
+                      "../../test/assets/jellyfish_test.riv",
+                      "../../test/assets/bullet_man.riv"})
+    {
+        auto file = ReadRiveFile(path);
+        auto source = file->artboard();
+        size_t objectCount = 0, objectBytes = 0;
+        for (auto object : source->objects())
+        {
+            if (object != nullptr && object != source)
+            {
+                objectCount++;
+                objectBytes += object->cloneSize();
+            }
+        }
+        printf("%s: %zu objects, %zu bytes\n", path, objectCount, objectBytes);
+
+        for (auto allocation : {ObjectAllocation::individual, ObjectAllocation::arena})
+        {
+            std::vector<std::unique_ptr<rive::ArtboardInstance>> instances;
+            instances.reserve(instanceCount);
+            AllocationCounter counter;
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < instanceCount; i++)
+            {
+                instances.push_back(source->instance(allocation));
+            }
+            auto instanced = std::chrono::high_resolution_clock::now();
+            size_t allocations = counter.allocations() / instanceCount;
+            size_t bytes = counter.bytes() / instanceCount;
+
+            std::vector<std::unique_ptr<rive::LinearAnimationInstance>> animations;
+            for (auto& instance : instances)
+            {
+                animations.push_back(instance->animationAt(0));
+            }
+            rive::NoOpRenderer renderer;
+            auto updateStart = std::chrono::high_resolution_clock::now();
+            for (int frame = 0; frame < frames; frame++)
+            {
+                for (int i = 0; i < instanceCount; i++)
+                {
+                    if (animations[i] != nullptr)
+                    {
+                        animations[i]->advanceAndApply(1.0f / 60.0f);
+                    }
+                    instances[i]->draw(&renderer);
+                }
+            }
+            auto updated = std::chrono::high_resolution_clock::now();
+            animations.clear();
+            instances.clear();
+            auto destroyed = std::chrono::high_resolution_clock::now();
+
+            using ms = std::chrono::duration<double, std::milli>;
+            printf("  %s: %d instances (%zu allocations, %zu bytes each) %.2fms, "
+                   "update+draw %.3fms/frame, destroy %.2fms\n",
+                   allocation == ObjectAllocation::arena ? "arena     " : "individual",
+                   instanceCount,
+                   allocations,
+                   bytes,
+                   ms(instanced - start).count(),
+                   ms(updated - updateStart).count() / frames,
+                   ms(destroyed - updated).count());
+        }
+    }
+}
+
+TEST_CASE("a const file can be instanced from many threads", "[instancing]")
+{
+    RenderObjectLeakChecker checker;
+    for (auto path : {"../../test/assets/bullet_man.riv",
+                      "../../test/assets/juice.riv",
+                      "../../test/assets/jellyfish_test.riv",
+                      "../../test/assets/multiple_state_machines.riv",
+                      "../../test/assets/off_road_car.riv",
+                      "../../test/assets/two_artboards.riv",
+                      "../../test/assets/two_bone_ik.riv",
+                      "../../test/assets/walle.riv"})
+    {
+        auto source = rive::ByteSource::mapFile(path);
+        REQUIRE(source != nullptr);
+
+        // What each artboard should draw, from a file of its own.
+        auto reference = rive::File::import(source, &gNoOpFactory);
+        REQUIRE(reference != nullptr);
+        auto count = reference->artboardCount();
+        std::vector<std::vector<float>> expected;
+        std::vector<size_t> namedIndices;
+        for (size_t i = 0; i < count; i++)
+        {
+            expected.push_back(playAndDraw(reference->artboardAt(i).get()));
+            // Looking an artboard up by name finds the first with that name.
+            auto name = reference->artboardNameAt(i);
+            size_t named = 0;
+            while (reference->artboardNameAt(named) != name)
+            {
+                named++;
+            }
+            namedIndices.push_back(named);
+        }
+
+        for (auto loading : {rive::ArtboardLoading::eager, rive::ArtboardLoading::lazy})
+        {
+            auto file = rive::File::import(source, &gNoOpFactory, nullptr, nullptr, loading);
+            REQUIRE(file != nullptr);
+            const rive::File& shared = *file;
+
+            const size_t threadCount = 8;
+            std::vector<size_t> mismatches(threadCount, 0);
+            std::vector<std::thread> threads;
+            for (size_t t = 0; t < threadCount; t++)
+            {
+                threads.emplace_back([&, t]() {
+                    for (int round = 0; round < 4; round++)
+                    {
+                        for (size_t i = 0; i < count; i++)
+                        {
+                            // Threads start at different artboards, half of
+                            // them look artboards up by name.
+                            auto index = (i + t) % count;
+                            std::unique_ptr<rive::ArtboardInstance> artboard;
+                            if (t % 2 == 0)
+                            {
+                                artboard = shared.artboardAt(index);
+                            }
+                            else
+                            {
+                                artboard = shared.artboardNamed(shared.artboardNameAt(index));
+                                index = namedIndices[index];
+                            }
+                            if (artboard == nullptr ||
+                                playAndDraw(artboard.get()) != expected[index])
+                            {
+                                mismatches[t]++;
+                            }
+                        }
+                    }
+                });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+            for (auto count : mismatches)
+            {
+                REQUIRE(count == 0);
+            }
+        }
+    }
+}
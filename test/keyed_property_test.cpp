@@ -0,0 +1,161 @@
+#include <rive/animation/keyed_property.hpp>
+#include <rive/animation/keyframe_color.hpp>
+#include <rive/animation/keyframe_double.hpp>
+#include <rive/node.hpp>
+#include <rive/shapes/paint/color.hpp>
+#include <rive/shapes/paint/solid_color.hpp>
+#include <catch.hpp>
+#include <cstdio>
+
+static std::unique_ptr<rive::KeyedProperty> makeXProperty(int numKeyFrames)
+{
+    auto property = std::make_unique<rive::KeyedProperty>();
+    property->propertyKey(rive::NodeBase::xPropertyKey);
+    for (int i = 0; i < numKeyFrames; i++)
+    {
+        auto keyFrame = std::make_unique<rive::KeyFrameDouble>();
+        keyFrame->frame(i * 2);
+        keyFrame->value((float)i);
+        keyFrame->interpolationType(1);
+        keyFrame->computeSeconds(60);
+        property->addKeyFrame(std::move(keyFrame));
+    }
+    // Resolves the property's accessors (keyframes have no interpolators to
+    // look up so no context is needed).
+    REQUIRE(property->onAddedDirty(nullptr) == rive::StatusCode::Ok);
+    return property;
+}
+
+TEST_CASE("keyframe cursor matches binary search", "[animation]")
+{
+    auto property = makeXProperty(100);
+
+    int cursor = 0;
+    auto check = [&](float seconds) {
+        cursor = property->closestFrameIndex(seconds, cursor);
+        REQUIRE(cursor == property->closestFrameIndex(seconds));
+    };
+
+    // Sequential forward playback, including landing exactly on keys.
+    for (int frame = 0; frame <= 220; frame++)
+    {
+        check(frame / 60.0f);
+    }
+    // Backwards playback.
+    for (int frame = 220; frame >= -10; frame--)
+    {
+        check(frame / 60.0f);
+    }
+    // Seeks and loops.
+    check(3.0f);
+    check(0.0f);
+    check(1.5f);
+    check(0.25f);
+    check(100.0f);
+
+    // Out of range hints fall back to the search.
+    REQUIRE(property->closestFrameIndex(0.5f, -1) == property->closestFrameIndex(0.5f));
+    REQUIRE(property->closestFrameIndex(0.5f, 1000) == property->closestFrameIndex(0.5f));
+}
+
+TEST_CASE("applying with a keyframe cursor matches applying without", "[animation]")
+{
+    auto property = makeXProperty(10);
+    rive::Node withCursor, withoutCursor;
+
+    int cursor = 0;
+    for (float seconds : {0.0f, 0.01f, 0.1f, 0.11f, 0.2f, 0.05f, 0.3f, 0.0f, 1.0f})
+    {
+        property->apply(&withCursor, seconds, 1.0f, &cursor);
+        property->apply(&withoutCursor, seconds, 1.0f);
+        REQUIRE(withCursor.x() == withoutCursor.x());
+    }
+    REQUIRE(withCursor.x() == 9.0f);
+}
+
+TEST_CASE("keyframes sharing a time resolve to the first of them", "[animation]")
+{
+    // Keys at frames 0, 10, 10, 10, 20 with values 0..4, a jump at 10.
+    auto property = std::make_unique<rive::KeyedProperty>();
+    property->propertyKey(rive::NodeBase::xPropertyKey);
+    int frames[] = {0, 10, 10, 10, 20};
+    for (int i = 0; i < 5; i++)
+    {
+        auto keyFrame = std::make_unique<rive::KeyFrameDouble>();
+        keyFrame->frame(frames[i]);
+        keyFrame->value((float)i);
+        keyFrame->interpolationType(1);
+        keyFrame->computeSeconds(10);
+        property->addKeyFrame(std::move(keyFrame));
+    }
+    REQUIRE(property->onAddedDirty(nullptr) == rive::StatusCode::Ok);
+
+    REQUIRE(property->closestFrameIndex(1.0f) == 1);
+    for (int hint = 0; hint <= 5; hint++)
+    {
+        REQUIRE(property->closestFrameIndex(1.0f, hint) == 1);
+    }
+
+    // Playing up to the shared time and seeking straight to it apply the
+    // same keyframe.
+    rive::Node played, seeked;
+    int cursor = 0;
+    for (float seconds : {0.0f, 0.5f, 0.9f, 1.0f})
+    {
+        property->apply(&played, seconds, 1.0f, &cursor);
+    }
+    property->apply(&seeked, 1.0f, 1.0f);
+    REQUIRE(played.x() == 1.0f);
+    REQUIRE(seeked.x() == 1.0f);
+}
+
+TEST_CASE("property accessors resolve typed thunks", "[animation]")
+{
+    auto accessors = rive::PropertyAccessors::resolve(rive::NodeBase::xPropertyKey);
+    REQUIRE(accessors.setDouble != nullptr);
+    REQUIRE(accessors.getDouble != nullptr);
+    REQUIRE(accessors.setColor == nullptr);
+    REQUIRE(accessors.setBool == nullptr);
+
+    rive::Node node;
+    accessors.setDouble(&node, 12.0f);
+    REQUIRE(node.x() == 12.0f);
+    REQUIRE(accessors.getDouble(&node) == 12.0f);
+
+    // Keys this runtime doesn't know about resolve to nothing.
+    auto unknown = rive::PropertyAccessors::resolve(0xFFFF);
+    REQUIRE(unknown.setDouble == nullptr);
+    REQUIRE(unknown.setUint == nullptr);
+}
+
+TEST_CASE("compacted keyframes evaluate by type", "[animation]")
+{
+    rive::KeyedProperty property;
+    property.propertyKey(rive::SolidColorBase::colorValuePropertyKey);
+    uint32_t colors[] = {0xFF000000, 0xFFFFFFFF, 0xFF0000FF};
+    for (int i = 0; i < 3; i++)
+    {
+        auto keyFrame = std::make_unique<rive::KeyFrameColor>();
+        keyFrame->frame(i * 10);
+        keyFrame->value(colors[i]);
+        // Second segment holds its value.
+        keyFrame->interpolationType(i == 1 ? 0 : 1);
+        keyFrame->computeSeconds(10);
+        property.addKeyFrame(std::move(keyFrame));
+    }
+    REQUIRE(property.onAddedDirty(nullptr) == rive::StatusCode::Ok);
+    REQUIRE(property.valueType() == rive::KeyFrameValueType::color);
+    REQUIRE(property.numKeyFrames() == 3);
+
+    rive::SolidColor solidColor;
+    property.apply(&solidColor, 0.0f, 1.0f);
+    REQUIRE((uint32_t)solidColor.colorValue() == 0xFF000000);
+    property.apply(&solidColor, 0.5f, 1.0f);
+    REQUIRE((uint32_t)solidColor.colorValue() == rive::colorLerp(0xFF000000, 0xFFFFFFFF, 0.5f));
+    property.apply(&solidColor, 1.5f, 1.0f);
+    REQUIRE((uint32_t)solidColor.colorValue() == 0xFFFFFFFF);
+    property.apply(&solidColor, 2.0f, 1.0f);
+    REQUIRE((uint32_t)solidColor.colorValue() == 0xFF0000FF);
+    property.apply(&solidColor, 5.0f, 1.0f);
+    REQUIRE((uint32_t)solidColor.colorValue() == 0xFF0000FF);
+}
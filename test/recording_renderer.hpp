@@ -0,0 +1,35 @@
+#ifndef _RIVE_RECORDING_RENDERER_HPP_
+#define _RIVE_RECORDING_RENDERER_HPP_
+
+#include <rive/artboard.hpp>
+#include <rive/math/mat2d.hpp>
+#include <utils/no_op_renderer.hpp>
+#include <utility>
+#include <vector>
+
+// Records what's drawn, in the order it's drawn: the six values of each
+// transform and -1 for each path.
+class RecordingRenderer : public rive::NoOpRenderer
+{
+public:
+    std::vector<float> values;
+
+    void transform(const rive::Mat2D& matrix) override
+    {
+        for (int i = 0; i < 6; i++)
+        {
+            values.push_back(matrix[i]);
+        }
+    }
+    void drawPath(rive::RenderPath*, rive::RenderPaint*) override { values.push_back(-1.0f); }
+};
+
+// What the artboard draws, as recorded by a RecordingRenderer.
+inline std::vector<float> recordDraw(rive::Artboard* artboard)
+{
+    RecordingRenderer renderer;
+    artboard->draw(&renderer);
+    return std::move(renderer.values);
+}
+
+#endif
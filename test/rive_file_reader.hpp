@@ -50,12 +50,12 @@ public:
     }
     ~RenderObjectLeakChecker()
     {
-        const int* after = rive::Counter::counts;
         for (int i = 0; i < rive::Counter::kNumTypes; ++i)
         {
-            if (rive::Counter::counts[i] != m_before[i])
+            int after = rive::Counter::counts[i];
+            if (after != m_before[i])
             {
-                printf("[%d] before:%d after:%d\n", i, m_before[i], after[i]);
+                printf("[%d] before:%d after:%d\n", i, m_before[i], after);
                 REQUIRE(false);
             }
         }
@@ -0,0 +1,160 @@
+#include <rive/animation/linear_animation_instance.hpp>
+#include <rive/animation/state_machine_instance.hpp>
+#include <rive/file.hpp>
+#include <rive/scene_scheduler.hpp>
+#include <rive/worker_pool.hpp>
+#include "recording_renderer.hpp"
+#include "rive_file_reader.hpp"
+#include <catch.hpp>
+#include <chrono>
+#include <cstdio>
+
+namespace
+{
+// Instances of every artboard in the file, each with a scene for its first
+// state machine or animation. The last instance gets a scene for each of its
+// animations, which must advance in order.
+struct Scenes
+{
+    std::vector<std::unique_ptr<rive::ArtboardInstance>> artboards;
+    std::vector<std::unique_ptr<rive::Scene>> scenes;
+
+    Scenes(const rive::File& file, size_t copies)
+    {
+        for (size_t copy = 0; copy < copies; copy++)
+        {
+            for (size_t i = 0; i < file.artboardCount(); i++)
+            {
+                auto artboard = file.artboardAt(i);
+                if (artboard->stateMachineCount() > 0)
+                {
+                    scenes.push_back(artboard->stateMachineAt(0));
+                }
+                else if (artboard->animationCount() > 0)
+                {
+                    scenes.push_back(artboard->animationAt(0));
+                }
+                artboards.push_back(std::move(artboard));
+            }
+        }
+        auto& shared = artboards.back();
+        for (size_t i = 0; i < shared->animationCount(); i++)
+        {
+            scenes.push_back(shared->animationAt(i));
+        }
+    }
+};
+} // namespace
+
+TEST_CASE("scheduled scenes advance like scenes advanced one at a time", "[scene_scheduler]")
+{
+    rive::WorkerPool workers(4);
+    for (auto path : {"../../test/assets/bullet_man.riv",
+                      "../../test/assets/juice.riv",
+                      "../../test/assets/light_switch.riv",
+                      "../../test/assets/multiple_state_machines.riv",
+                      "../../test/assets/two_artboards.riv",
+                      "../../test/assets/two_bone_ik.riv"})
+    {
+        auto file = ReadRiveFile(path);
+        Scenes serial(*file, 8);
+        Scenes scheduled(*file, 8);
+        rive::SceneScheduler scheduler(&workers);
+        for (size_t i = 0; i < scheduled.scenes.size(); i++)
+        {
+            scheduler.add(scheduled.scenes[i].get(), 0.0f);
+        }
+        REQUIRE(scheduler.size() == serial.scenes.size());
+
+        for (int tick = 0; tick < 30; tick++)
+        {
+            std::vector<bool> needsDraw;
+            for (size_t i = 0; i < serial.scenes.size(); i++)
+            {
+                // Scenes advance by different amounts.
+                float elapsedSeconds = (1 + (tick + i) % 3) / 60.0f;
+                scheduler.elapsedSeconds(i, elapsedSeconds);
+                needsDraw.push_back(serial.scenes[i]->advanceAndApply(elapsedSeconds));
+            }
+            scheduler.advanceAndApply();
+            for (size_t i = 0; i < serial.scenes.size(); i++)
+            {
+                REQUIRE(scheduler.needsDraw(i) == needsDraw[i]);
+            }
+            for (size_t i = 0; i < serial.artboards.size(); i++)
+            {
+                REQUIRE(recordDraw(scheduled.artboards[i].get()) ==
+                        recordDraw(serial.artboards[i].get()));
+            }
+        }
+    }
+}
+
+TEST_CASE("scenes can be scheduled without workers", "[scene_scheduler]")
+{
+    auto file = ReadRiveFile("../../test/assets/juice.riv");
+    Scenes serial(*file, 2);
+    Scenes scheduled(*file, 2);
+    rive::SceneScheduler scheduler(nullptr);
+    for (auto& scene : scheduled.scenes)
+    {
+        scheduler.add(scene.get(), 1.0f / 60.0f);
+    }
+    for (int tick = 0; tick < 10; tick++)
+    {
+        for (auto& scene : serial.scenes)
+        {
+            scene->advanceAndApply(1.0f / 60.0f);
+        }
+        scheduler.advanceAndApply();
+    }
+    for (size_t i = 0; i < serial.artboards.size(); i++)
+    {
+        REQUIRE(recordDraw(scheduled.artboards[i].get()) == recordDraw(serial.artboards[i].get()));
+    }
+
+    scheduler.clear();
+    REQUIRE(scheduler.size() == 0);
+    scheduler.advanceAndApply();
+}
+
+TEST_CASE("advance scenes on workers", "[.][benchmark]")
+{
+    auto file = ReadRiveFile("../../test/assets/bullet_man.riv");
+    std::vector<std::unique_ptr<rive::ArtboardInstance>> artboards;
+    std::vector<std::unique_ptr<rive::Scene>> scenes;
+    for (int i = 0; i < 1000; i++)
+    {
+        artboards.push_back(file->artboardDefault());
+        scenes.push_back(artboards.back()->animationAt(0));
+    }
+
+    double serial = 0.0;
+    for (size_t threadCount : {0, 1, 2, 4, 8})
+    {
+        std::unique_ptr<rive::WorkerPool> workers;
+        if (threadCount != 0)
+        {
+            workers = std::make_unique<rive::WorkerPool>(threadCount);
+        }
+        rive::SceneScheduler scheduler(workers.get());
+        for (auto& scene : scenes)
+        {
+            scheduler.add(scene.get(), 1.0f / 60.0f);
+        }
+        const int ticks = 20;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int tick = 0; tick < ticks; tick++)
+        {
+            scheduler.advanceAndApply();
+        }
+        std::chrono::duration<double, std::milli> elapsed =
+            std::chrono::high_resolution_clock::now() - start;
+        auto perTick = elapsed.count() / ticks;
+        serial = threadCount == 0 ? perTick : serial;
+        printf("1000 scenes, %zu threads: %.3fms/tick (%.2fx)\n",
+               threadCount,
+               perTick,
+               serial / perTick);
+    }
+}
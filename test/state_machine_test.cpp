@@ -10,6 +10,7 @@
 #include <rive/animation/blend_animation_1d.hpp>
 #include <rive/animation/blend_state_direct.hpp>
 #include <rive/animation/blend_state_transition.hpp>
+#include <rive/rive_counter.hpp>
 #include "catch.hpp"
 #include "rive_file_reader.hpp"
 #include <cstdio>
@@ -171,3 +172,86 @@ TEST_CASE("animation state with no animation doesn't crash", "[file]")
     auto abi = artboard->instance();
     rive::StateMachineInstance(stateMachine, abi.get()).advance(0.0f);
 }
+
+TEST_CASE("re-entering a state re-uses its instance", "[file]")
+{
+    auto file = ReadRiveFile("../../test/assets/rocket.riv");
+
+    auto artboard = file->artboard()->instance();
+    auto stateMachine = artboard->stateMachineAt(0);
+    REQUIRE(stateMachine != nullptr);
+    auto hover = stateMachine->getBool("Hover");
+    REQUIRE(hover != nullptr);
+
+    stateMachine->advance(0.0f);
+    REQUIRE(stateMachine->currentAnimationCount() == 1);
+    auto idle = stateMachine->currentAnimationByIndex(0);
+    REQUIRE(idle->animation()->name() == "idle");
+
+    // Visit the hover state once so both states have been instanced.
+    hover->value(true);
+    stateMachine->advance(1.0f);
+    hover->value(false);
+    stateMachine->advance(1.0f);
+    REQUIRE(stateMachine->currentAnimationByIndex(0) == idle);
+
+    int animationInstances = rive::Counter::counts[rive::Counter::kLinearAnimationInstance];
+    for (int i = 0; i < 10; i++)
+    {
+        hover->value(true);
+        stateMachine->advance(1.0f);
+        REQUIRE(stateMachine->currentAnimationByIndex(0)->animation()->name() == "Roll_over");
+        hover->value(false);
+        stateMachine->advance(1.0f);
+        REQUIRE(stateMachine->currentAnimationByIndex(0) == idle);
+        // Entering the state again rewinds it.
+        REQUIRE(idle->time() <= 1.0f);
+    }
+    REQUIRE(rive::Counter::counts[rive::Counter::kLinearAnimationInstance] ==
+            animationInstances);
+}
+
+TEST_CASE("settled layers sleep until an input they read changes", "[file]")
+{
+    auto file = ReadRiveFile("../../test/assets/light_switch.riv");
+
+    auto artboard = file->artboard()->instance();
+    auto stateMachine = artboard->stateMachineAt(0);
+    REQUIRE(stateMachine != nullptr);
+    auto on = stateMachine->getBool("On");
+    REQUIRE(on != nullptr);
+
+    auto settle = [&]() {
+        int frames = 0;
+        while (stateMachine->advance(1.0f / 60.0f))
+        {
+            REQUIRE(++frames < 1000);
+        }
+    };
+    settle();
+    auto settledAnimation = stateMachine->currentAnimationByIndex(0);
+    REQUIRE(settledAnimation != nullptr);
+    auto settledName = settledAnimation->animation()->name();
+
+    // Nothing changes while no input does.
+    for (int i = 0; i < 10; i++)
+    {
+        REQUIRE(!stateMachine->advance(1.0f / 60.0f));
+        REQUIRE(stateMachine->stateChangedCount() == 0);
+    }
+
+    // Changing the input wakes the layer, which transitions out and settles
+    // again.
+    on->value(!on->value());
+    REQUIRE(stateMachine->needsAdvance());
+    stateMachine->advance(1.0f / 60.0f);
+    REQUIRE(stateMachine->stateChangedCount() == 1);
+    settle();
+    REQUIRE(stateMachine->currentAnimationByIndex(0)->animation()->name() != settledName);
+
+    on->value(!on->value());
+    stateMachine->advance(1.0f / 60.0f);
+    REQUIRE(stateMachine->stateChangedCount() == 1);
+    settle();
+    REQUIRE(stateMachine->currentAnimationByIndex(0)->animation()->name() == settledName);
+}
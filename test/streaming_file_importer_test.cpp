@@ -0,0 +1,118 @@
+#include <rive/byte_source.hpp>
+#include <rive/file.hpp>
+#include <rive/streaming_file_importer.hpp>
+#include "rive_file_reader.hpp"
+#include <catch.hpp>
+#include <algorithm>
+#include <cstdio>
+
+// Feeds the bytes to an importer in chunks of chunkSize bytes.
+static std::unique_ptr<rive::File> streamFile(rive::Span<const uint8_t> bytes,
+                                              size_t chunkSize,
+                                              rive::ImportResult* result)
+{
+    rive::StreamingFileImporter importer(&gNoOpFactory);
+    for (size_t offset = 0; offset < bytes.size(); offset += chunkSize)
+    {
+        auto size = std::min(chunkSize, bytes.size() - offset);
+        if (importer.append(bytes.subset(offset, size)) != rive::ImportResult::success)
+        {
+            break;
+        }
+    }
+    return importer.finish(result);
+}
+
+TEST_CASE("files imported in chunks match files imported at once", "[file]")
+{
+    for (auto path : {"../../test/assets/two_artboards.riv",
+                      "../../test/assets/juice.riv",
+                      "../../test/assets/bullet_man.riv",
+                      "../../test/assets/jellyfish_test.riv",
+                      "../../test/assets/multiple_state_machines.riv"})
+    {
+        auto source = rive::ByteSource::mapFile(path);
+        REQUIRE(source != nullptr);
+        auto expected = rive::File::import(source->bytes(), &gNoOpFactory);
+        REQUIRE(expected != nullptr);
+        for (size_t chunkSize : {1, 13, 4096, 1 << 30})
+        {
+            // Byte at a time is slow on the big file, and says nothing new.
+            if (chunkSize == 1 && source->bytes().size() > 1 << 20)
+            {
+                continue;
+            }
+            rive::ImportResult result;
+            auto file = streamFile(source->bytes(), chunkSize, &result);
+            REQUIRE(result == rive::ImportResult::success);
+            REQUIRE(file != nullptr);
+            REQUIRE(file->artboardCount() == expected->artboardCount());
+            REQUIRE(file->assets().size() == expected->assets().size());
+            for (size_t i = 0; i < expected->artboardCount(); i++)
+            {
+                auto artboard = file->artboard(i);
+                auto expectedArtboard = expected->artboard(i);
+                REQUIRE(artboard->name() == expectedArtboard->name());
+                REQUIRE(artboard->objects().size() == expectedArtboard->objects().size());
+                REQUIRE(artboard->animationCount() == expectedArtboard->animationCount());
+                REQUIRE(artboard->stateMachineCount() == expectedArtboard->stateMachineCount());
+                REQUIRE(artboard->instance() != nullptr);
+            }
+        }
+    }
+}
+
+TEST_CASE("streamed artboards are available before the file is complete", "[file]")
+{
+    auto source = rive::ByteSource::mapFile("../../test/assets/bullet_man.riv");
+    REQUIRE(source != nullptr);
+    auto bytes = source->bytes();
+
+    rive::StreamingFileImporter importer(&gNoOpFactory);
+    REQUIRE(importer.file() == nullptr);
+    size_t firstArtboardAt = 0;
+    size_t artboardCount = 0;
+    const size_t chunkSize = 1024;
+    for (size_t offset = 0; offset < bytes.size(); offset += chunkSize)
+    {
+        auto size = std::min(chunkSize, bytes.size() - offset);
+        REQUIRE(importer.append(bytes.subset(offset, size)) == rive::ImportResult::success);
+        auto file = importer.file();
+        if (file == nullptr)
+        {
+            continue;
+        }
+        // Artboards only ever get added, and are complete once they are.
+        REQUIRE(file->artboardCount() >= artboardCount);
+        artboardCount = file->artboardCount();
+        if (artboardCount != 0 && firstArtboardAt == 0)
+        {
+            firstArtboardAt = offset + size;
+            REQUIRE(file->artboard(0)->instance() != nullptr);
+        }
+    }
+    REQUIRE(firstArtboardAt != 0);
+    REQUIRE(firstArtboardAt < bytes.size());
+
+    auto file = importer.finish();
+    REQUIRE(file != nullptr);
+    REQUIRE(file->artboardCount() == 11);
+    REQUIRE(file->artboardCount() > artboardCount);
+}
+
+TEST_CASE("incomplete streamed files don't import", "[file]")
+{
+    auto source = rive::ByteSource::mapFile("../../test/assets/two_artboards.riv");
+    REQUIRE(source != nullptr);
+    auto bytes = source->bytes();
+
+    rive::ImportResult result;
+    REQUIRE(streamFile(bytes.subset(0, bytes.size() - 1), 64, &result) == nullptr);
+    REQUIRE(result == rive::ImportResult::malformed);
+    REQUIRE(streamFile(bytes.subset(0, 3), 64, &result) == nullptr);
+    REQUIRE(result == rive::ImportResult::malformed);
+
+    rive::StreamingFileImporter importer(&gNoOpFactory);
+    REQUIRE(importer.finish(&result) == nullptr);
+    REQUIRE(result == rive::ImportResult::malformed);
+}
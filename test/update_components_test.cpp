@@ -0,0 +1,334 @@
+#include <rive/animation/linear_animation_instance.hpp>
+#include <rive/artboard.hpp>
+#include <rive/file.hpp>
+#include <rive/node.hpp>
+#include <rive/worker_pool.hpp>
+#include <utils/no_op_factory.hpp>
+#include "recording_renderer.hpp"
+#include "rive_file_reader.hpp"
+#include <catch.hpp>
+#include <chrono>
+#include <cstdio>
+
+namespace
+{
+// Counts the updates it gets.
+class CountingNode : public rive::Node
+{
+public:
+    int updates = 0;
+
+    void update(rive::ComponentDirt value) override
+    {
+        updates++;
+        rive::Node::update(value);
+    }
+};
+
+// Builds a wide tree of nodes where node n is parented to node n / 8 (the
+// artboard is object 0), keeps the hierarchy shallow for big counts.
+template <typename T = rive::Node>
+void buildNodeTree(rive::Artboard& artboard, std::vector<T*>& nodes, size_t count)
+{
+    artboard.addObject(&artboard);
+    for (size_t i = 1; i <= count; i++)
+    {
+        auto node = new T();
+        node->parentId((uint32_t)(i / 8));
+        node->x(1.0f);
+        artboard.addObject(node);
+        nodes.push_back(node);
+    }
+}
+
+// The world transforms and opacities of every transform component followed
+// by what the artboard draws.
+std::vector<float> updatedState(rive::Artboard* artboard)
+{
+    std::vector<float> values;
+    for (auto object : artboard->objects())
+    {
+        if (object != nullptr && object->is<rive::TransformComponent>())
+        {
+            auto component = object->as<rive::TransformComponent>();
+            for (int i = 0; i < 6; i++)
+            {
+                values.push_back(component->worldTransform()[i]);
+            }
+            values.push_back(component->renderOpacity());
+        }
+    }
+    auto drawn = recordDraw(artboard);
+    values.insert(values.end(), drawn.begin(), drawn.end());
+    return values;
+}
+} // namespace
+
+TEST_CASE("updateComponents only updates dirty components", "[update]")
+{
+    rive::NoOpFactory factory;
+    rive::Artboard artboard(&factory);
+    std::vector<rive::Node*> nodes;
+    buildNodeTree(artboard, nodes, 100);
+    REQUIRE(artboard.initialize() == rive::StatusCode::Ok);
+
+    REQUIRE(artboard.updateComponents());
+    REQUIRE(!artboard.updateComponents());
+
+    // Node 9 is parented to node 1, which is parented to the artboard.
+    auto parent = nodes[0];
+    auto child = nodes[8];
+    REQUIRE(child->parent() == parent);
+    REQUIRE(child->worldTransform()[4] == 2.0f);
+
+    // Dirty a component that's after another dirty component in the graph.
+    child->x(5.0f);
+    parent->x(10.0f);
+    REQUIRE(artboard.updateComponents());
+    REQUIRE(parent->worldTransform()[4] == 10.0f);
+    REQUIRE(child->worldTransform()[4] == 15.0f);
+
+    // Updating the parent propagates to dependents that were otherwise clean.
+    auto grandChild = nodes[8 * 9 - 1];
+    REQUIRE(grandChild->parent() == child);
+    REQUIRE(grandChild->worldTransform()[4] == 16.0f);
+    parent->x(0.0f);
+    REQUIRE(artboard.updateComponents());
+    REQUIRE(grandChild->worldTransform()[4] == 6.0f);
+    REQUIRE(!artboard.updateComponents());
+}
+
+TEST_CASE("updateComponents skips clean components", "[update]")
+{
+    rive::NoOpFactory factory;
+    rive::Artboard artboard(&factory);
+    std::vector<CountingNode*> nodes;
+    buildNodeTree(artboard, nodes, 100);
+    REQUIRE(artboard.initialize() == rive::StatusCode::Ok);
+    REQUIRE(artboard.updateComponents());
+    auto resetCounts = [&]() {
+        for (auto node : nodes)
+        {
+            node->updates = 0;
+        }
+    };
+
+    // A leaf (node 100 is parented to node 12) is the only one updated.
+    auto leaf = nodes[99];
+    leaf->x(3.0f);
+    resetCounts();
+    REQUIRE(artboard.updateComponents());
+    for (auto node : nodes)
+    {
+        REQUIRE(node->updates == (node == leaf ? 1 : 0));
+    }
+
+    // Dirtying node 2 updates it and its descendants (nodes 16-23 and their
+    // children), once each, and nothing else.
+    auto branch = nodes[1];
+    branch->x(3.0f);
+    resetCounts();
+    REQUIRE(artboard.updateComponents());
+    for (auto node : nodes)
+    {
+        bool descendant = false;
+        for (auto component = (rive::Component*)node; component != nullptr;
+             component = component->parent())
+        {
+            descendant = descendant || component == branch;
+        }
+        REQUIRE(node->updates == (descendant ? 1 : 0));
+    }
+
+    resetCounts();
+    REQUIRE(!artboard.updateComponents());
+    for (auto node : nodes)
+    {
+        REQUIRE(node->updates == 0);
+    }
+}
+
+TEST_CASE("updateComponents cost scales with dirty count", "[.][benchmark]")
+{
+    rive::NoOpFactory factory;
+    for (size_t count : {1000, 10000, 100000})
+    {
+        rive::Artboard artboard(&factory);
+        std::vector<rive::Node*> nodes;
+        buildNodeTree(artboard, nodes, count);
+        REQUIRE(artboard.initialize() == rive::StatusCode::Ok);
+        artboard.updateComponents();
+
+        for (size_t dirtyCount : {1, 10, 100})
+        {
+            const int frames = 1000;
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int frame = 0; frame < frames; frame++)
+            {
+                // Pick leaves so the dirt doesn't fan out to dependents.
+                for (size_t i = 0; i < dirtyCount; i++)
+                {
+                    nodes[count - 1 - i]->x((float)frame);
+                }
+                artboard.updateComponents();
+            }
+            auto elapsed = std::chrono::high_resolution_clock::now() - start;
+            printf("updateComponents: %zu components, %zu dirty: %.3fus/frame\n",
+                   count,
+                   dirtyCount,
+                   std::chrono::duration<double, std::micro>(elapsed).count() / frames);
+        }
+    }
+}
+
+TEST_CASE("updateComponents with every transform changing", "[.][benchmark]")
+{
+    rive::NoOpFactory factory;
+    for (size_t count : {100, 1000, 10000})
+    {
+        rive::Artboard artboard(&factory);
+        std::vector<rive::Node*> nodes;
+        buildNodeTree(artboard, nodes, count);
+        REQUIRE(artboard.initialize() == rive::StatusCode::Ok);
+        artboard.updateComponents();
+
+        const int frames = 200;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int frame = 0; frame < frames; frame++)
+        {
+            // Like a rig where every bone is keyed.
+            for (size_t i = 0; i < count; i++)
+            {
+                nodes[i]->rotation(frame * 0.01f + i * 0.001f);
+                nodes[i]->scaleX(1.0f + frame * 0.001f);
+            }
+            artboard.updateComponents();
+        }
+        auto elapsed = std::chrono::high_resolution_clock::now() - start;
+        printf("updateComponents: %zu transforms: %.3fus/frame\n",
+               count,
+               std::chrono::duration<double, std::micro>(elapsed).count() / frames);
+    }
+}
+
+TEST_CASE("updating levels in parallel matches updating serially", "[update]")
+{
+    rive::WorkerPool workers(4);
+    for (auto path : {"../../test/assets/artboardclipping.riv",
+                      "../../test/assets/blend_test.riv",
+                      "../../test/assets/bullet_man.riv",
+                      "../../test/assets/circle_clips.riv",
+                      "../../test/assets/complex_ik_dependency.riv",
+                      "../../test/assets/dependency_test.riv",
+                      "../../test/assets/distance_constraint.riv",
+                      "../../test/assets/draw_rule_cycle.riv",
+                      "../../test/assets/jellyfish_test.riv",
+                      "../../test/assets/juice.riv",
+                      "../../test/assets/light_switch.riv",
+                      "../../test/assets/off_road_car.riv",
+                      "../../test/assets/rocket.riv",
+                      "../../test/assets/rotation_constraint.riv",
+                      "../../test/assets/scale_constraint.riv",
+                      "../../test/assets/shapetest.riv",
+                      "../../test/assets/tape.riv",
+                      "../../test/assets/transform_constraint.riv",
+                      "../../test/assets/translation_constraint.riv",
+                      "../../test/assets/trim_path_linear.riv",
+                      "../../test/assets/two_artboards.riv",
+                      "../../test/assets/two_bone_ik.riv",
+                      "../../test/assets/walle.riv"})
+    {
+        auto file = ReadRiveFile(path);
+        for (size_t i = 0; i < file->artboardCount(); i++)
+        {
+            auto serial = file->artboardAt(i);
+            auto parallel = file->artboardAt(i);
+            // Split every level with more than one dirty component.
+            parallel->updateWorkers(&workers, 1);
+            serial->advance(0.0f);
+            parallel->advance(0.0f);
+            REQUIRE(updatedState(serial.get()) == updatedState(parallel.get()));
+
+            for (size_t a = 0; a < serial->animationCount(); a++)
+            {
+                auto serialAnimation = serial->animationAt(a);
+                auto parallelAnimation = parallel->animationAt(a);
+                for (int frame = 0; frame < 20; frame++)
+                {
+                    serialAnimation->advanceAndApply(1.0f / 30.0f);
+                    parallelAnimation->advanceAndApply(1.0f / 30.0f);
+                    REQUIRE(updatedState(serial.get()) == updatedState(parallel.get()));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("updateComponents on workers", "[.][benchmark]")
+{
+    std::unique_ptr<rive::WorkerPool> pools[] = {nullptr,
+                                                 std::make_unique<rive::WorkerPool>(1),
+                                                 std::make_unique<rive::WorkerPool>(2),
+                                                 std::make_unique<rive::WorkerPool>(4),
+                                                 std::make_unique<rive::WorkerPool>(8)};
+    auto report = [](const char* name, rive::WorkerPool* workers, double elapsed, double serial) {
+        printf("%s, %zu threads: %.3fus/frame (%.2fx)\n",
+               name,
+               workers == nullptr ? (size_t)0 : workers->threadCount(),
+               elapsed,
+               serial / elapsed);
+    };
+
+    {
+        rive::NoOpFactory factory;
+        const size_t count = 10000;
+        rive::Artboard artboard(&factory);
+        std::vector<rive::Node*> nodes;
+        buildNodeTree(artboard, nodes, count);
+        REQUIRE(artboard.initialize() == rive::StatusCode::Ok);
+        double serial = 0.0;
+        for (auto& workers : pools)
+        {
+            artboard.updateWorkers(workers.get());
+            artboard.updateComponents();
+            const int frames = 100;
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int frame = 0; frame < frames; frame++)
+            {
+                for (size_t i = 0; i < count; i++)
+                {
+                    nodes[i]->rotation(frame * 0.01f + i * 0.001f);
+                }
+                artboard.updateComponents();
+            }
+            std::chrono::duration<double, std::micro> elapsed =
+                std::chrono::high_resolution_clock::now() - start;
+            auto perFrame = elapsed.count() / frames;
+            serial = workers == nullptr ? perFrame : serial;
+            report("10000 nodes", workers.get(), perFrame, serial);
+        }
+    }
+
+    for (auto path : {"../../test/assets/bullet_man.riv", "../../test/assets/off_road_car.riv"})
+    {
+        auto file = ReadRiveFile(path);
+        double serial = 0.0;
+        for (auto& workers : pools)
+        {
+            auto artboard = file->artboardDefault();
+            artboard->updateWorkers(workers.get());
+            auto animation = artboard->animationAt(0);
+            const int frames = 200;
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int frame = 0; frame < frames; frame++)
+            {
+                animation->advanceAndApply(1.0f / 60.0f);
+            }
+            std::chrono::duration<double, std::micro> elapsed =
+                std::chrono::high_resolution_clock::now() - start;
+            auto perFrame = elapsed.count() / frames;
+            serial = workers == nullptr ? perFrame : serial;
+            report(path, workers.get(), perFrame, serial);
+        }
+    }
+}
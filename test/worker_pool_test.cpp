@@ -0,0 +1,50 @@
+#include <rive/worker_pool.hpp>
+#include <catch.hpp>
+#include <atomic>
+#include <vector>
+
+TEST_CASE("parallelFor visits every index once", "[worker_pool]")
+{
+    for (size_t threadCount : {1, 2, 4, 8})
+    {
+        rive::WorkerPool workers(threadCount);
+        REQUIRE(workers.threadCount() == threadCount);
+        for (size_t count : {0, 1, 7, 1000})
+        {
+            std::vector<std::atomic<int>> visits(count);
+            workers.parallelFor(count, [&](size_t index) { visits[index]++; });
+            for (auto& visit : visits)
+            {
+                REQUIRE(visit == 1);
+            }
+        }
+    }
+}
+
+TEST_CASE("parallelFor can be called from within work", "[worker_pool]")
+{
+    rive::WorkerPool workers(4);
+    std::atomic<int> total(0);
+    workers.parallelFor(16, [&](size_t) {
+        workers.parallelFor(16, [&](size_t) { total++; });
+    });
+    REQUIRE(total == 256);
+}
+
+TEST_CASE("submitted tasks all run", "[worker_pool]")
+{
+    for (size_t threadCount : {1, 3})
+    {
+        std::atomic<int> ran(0);
+        {
+            rive::WorkerPool workers(threadCount);
+            for (int i = 0; i < 100; i++)
+            {
+                workers.submit([&ran]() { ran++; });
+            }
+            // Tasks and parallelFor share the threads.
+            workers.parallelFor(10, [&](size_t) { ran++; });
+        }
+        REQUIRE(ran == 110);
+    }
+}